@@ -11,15 +11,188 @@
 #define USART2_BAUD             115200
 #define TICK_PERIOD_MS          10
 
-// 实际每毫米的脉冲数 (经测量校准)
-#define ACTUAL_PULSE_PER_MM     15.518f
+// 参数页: 64 KB Flash 的最后一页 (链接器 IROM1 已相应缩小)
+#define PARAM_FLASH_ADDR        0x0800FC00u
+// 编码器速度观测器带宽 (Hz)
+#define ENCODER_OBSERVER_BW_HZ  5.0f
 
+// 升降台运动监视: 10 ms 周期, 200 ms 窗口
+static const lift_monitor_cfg_t lift_monitor_cfg = {
+    .window_ticks = 20,
+    .start_grace_ticks = 30,                                    // 继电器吸合 + 电机加速
+    .stop_grace_ticks = 50,                                     // 停车惯性
+    .stall_pulses = (int32_t)(1.0f * ACTUAL_PULSE_PER_MM),      // 窗口内至少 1 mm
+    .wrong_dir_pulses = (int32_t)(3.0f * ACTUAL_PULSE_PER_MM),
+    .creep_pulses = (int32_t)(3.0f * ACTUAL_PULSE_PER_MM),
+};
+
+// 升降台停车惯性模型: 初值按实测约 0.15 s, 之后在线学习
+static const lift_coast_cfg_t lift_coast_cfg = {
+    .k_up_s = 0.15f,
+    .k_down_s = 0.15f,
+    .learn_rate = 0.3f,
+    .lead_s = 0.08f,
+    .min_speed_mm_s = 20.0f,        // 短距离修正未达稳速, 不参与学习
+    .still_speed_mm_s = 1.0f,
+    .still_ticks = 10,
+    .timeout_ticks = 200,
+};
+
+// 升降台位置 PID: 误差 (mm) -> 占空比 (±1)
+// 位置式: 点动切入定位时由 track 反算积分接续输出; 或入 PID_MODE_INCREMENTAL 改为增量式
+// (同一组增益, 在线改增益时输出不跳变)
+// 前馈为轨迹速度前馈 (或前馈模型)
+// 微分作用于跟踪误差: 参考为 S 形轨迹, 没有设定值突变; 微分先行会按 -kd·v 抵消运动中的前馈
+static const pid_cfg_t lift_pid_cfg = {
+    .mode = PID_MODE_PID,
+    .features = PID_FEAT_OUTPUT_LIMIT | PID_FEAT_ANTI_WINDUP | PID_FEAT_INTEGRAL_SEP
+        | PID_FEAT_DEADBAND | PID_FEAT_DIFF_FILTER | PID_FEAT_FEEDFORWARD,
+    .kp = 0.2f,                     // 5 mm 误差满占空比
+    .ki = 0.05f,
+    .kd = 0.06f,
+    .max_out = 1.0f,
+    .integral_separation = 5.0f,    // 误差 5 mm 以内才叠加积分
+    .dead_band = 0.5f,
+    .diff_filter_alpha = 0.3f,
+    .output_max_rate = 0.0f,
+};
+
+#if LIFT_CTRL_CASCADE
+// 串级位置环: 误差 (mm) -> 速度指令 (mm/s), 前馈为轨迹速度
+// 位置式: 速度环饱和时由 s_lift_ctrl 冻结积分
+static const pid_cfg_t lift_cascade_pos_cfg = {
+    .mode = PID_MODE_PI,
+    .features = PID_FEAT_OUTPUT_LIMIT | PID_FEAT_ANTI_WINDUP | PID_FEAT_DEADBAND | PID_FEAT_FEEDFORWARD,
+    .kp = 4.0f,                     // 1 mm 误差 4 mm/s
+    .ki = 0.5f,
+    .kd = 0.0f,
+    .max_out = 40.0f,               // 满占空比速度
+    .integral_separation = 0.0f,
+    .dead_band = 0.5f,
+    .diff_filter_alpha = 1.0f,
+    .output_max_rate = 0.0f,
+};
+
+// 串级速度环: 速度误差 (mm/s) -> 占空比 (±1), 前馈为速度指令 × vff_s_mm
+static const pid_cfg_t lift_cascade_vel_cfg = {
+    .mode = PID_MODE_PI | PID_MODE_INCREMENTAL,
+    .features = PID_FEAT_OUTPUT_LIMIT | PID_FEAT_FEEDFORWARD,
+    .kp = 0.04f,
+    .ki = 0.3f,                     // 积分消除负载 (夹持重物) 引起的速度偏差
+    .kd = 0.0f,
+    .max_out = 1.0f,
+    .integral_separation = 0.0f,
+    .dead_band = 0.0f,
+    .diff_filter_alpha = 1.0f,
+    .output_max_rate = 0.0f,
+};
+#endif
+
+// PID 对比测试的仿真对象: 与继电器全速运行时的稳态速度, 起动滞后相当
+static const pid_bench_plant_t pid_bench_plant = {
+    .v_max = 40.0f,
+    .tau_s = 0.1f,
+};
+
+// 软限位: 下限位离开回零开关, 上限位按机械行程留余量 ($LIFT_LIMITS 可在线修改并保存)
+static const lift_limit_cfg_t lift_limit_cfg = {
+    .min_mm = 2.0f,
+    .max_mm = 300.0f,
+    .decel_mm_s2 = 50.0f,           // 低于继电器断开后的滑行减速度
+    .creep_mm_s = 3.0f,
+    .full_speed_mm_s = 40.0f,
+};
+
+// 增益调度: 方向 / 负载切换后约 0.6 s 过渡到新增益 ($PID_SCHED 命令编辑)
+static const lift_gains_cfg_t lift_gains_cfg = {
+    .blend_tau_s = 0.2f,
+    .dir_speed_mm_s = 1.0f,
+};
+
+// 阶跃响应分析: 调节带 2 % (不小于到位误差带), 稳态误差取最后 0.5 s (未抽取时)
+static const step_resp_cfg_t step_resp_cfg = {
+    .band_pct = 2.0f,
+    .band_min_mm = 1.0f,
+    .ss_samples = 50,
+};
+
+// 阶跃辨识: 继电器满幅驱动, 每个方向 0.8 s 或 30 mm, 后 0.4 s 拟合渐近线 (应远大于 L + 3τ)
+static const lift_ident_cfg_t lift_ident_cfg = {
+    .amp = 1.0f,
+    .run_s = 0.8f,
+    .travel_mm = 30.0f,
+    .move_mm = 0.3f,                // 约 5 个编码器脉冲
+    .still_s = 0.5f,
+};
+
+// 纯滞后补偿: 扰动估计 0.5 s (数倍于约 80 ms 的纯滞后)
+static const lift_smith_cfg_t lift_smith_cfg = {
+    .period_s = TICK_PERIOD_MS / 1000.0f,
+    .obs_tau_s = 0.5f,
+};
+
+// 前馈模型辨识: 匀速 12 / 20 / 28 mm/s (时间比例输出可达), 每段 1 s 进入匀速 + 1 s 平均, 上下交替
+static const lift_ff_cfg_t lift_ff_cfg = {
+    .still_mm_s = 1.0f,
+    .blend_mm_s = 1.0f,
+    .speed_mm_s = {12.0f, 20.0f, 28.0f},
+    .settle_s = 1.0f,
+    .measure_s = 1.0f,
+    .still_s = 0.5f,
+    .travel_mm = 80.0f,             // 28 mm/s × 2 s 加余量
+    .ramp_per_s = 0.3f,             // 约 80 ms 纯滞后使起步值偏大约 0.02
+    .move_mm = 0.3f,
+    .u0_s_mm = 1.0f / 40.0f,
+    .kp = 0.01f,
+    .ki = 0.1f,
+};
+
+// 定位轨迹: 参考速度低于全速, 为闭环留出余量
+static const lift_profile_cfg_t lift_profile_cfg = {
+    .v_max = 30.0f,
+    .a_max = 100.0f,
+    .j_max = 1000.0f,               // 加速段 0.1 s
+    .tick_s = TICK_PERIOD_MS / 1000.0f,
+};
+
+// 时间比例窗口 100 ms, 最短接通 40 ms (继电器吸合 + 电机起动)
+static const lift_ctrl_cfg_t lift_ctrl_cfg = {
+#if LIFT_DRIVE_PWM
+    .window_ticks = 0,              // PWM 驱动: 占空比直接输出
+    .min_on_ticks = 0,
+#else
+    .window_ticks = 10,
+    .min_on_ticks = 4,
+#endif
+    .period_s = TICK_PERIOD_MS / 1000.0f,
+    .vff_s_mm = 1.0f / 40.0f,       // 满占空比约 40 mm/s (同 full_speed_mm_s)
+    .outer_div = 2,                 // 串级: 位置环 50 Hz, 速度环 100 Hz
+    .settle_band_mm = 1.0f,
+    .settle_hold_s = 0.5f,
+};
+
+#if !LIFT_DRIVE_PWM
 static const relay_cfg_t relay_cfg = {
     .rcc_mask = RCC_APB2Periph_GPIOB,
     .rcc_bus = 2,
     .port = GPIOB,
     .pin_a = GPIO_Pin_0,
     .pin_b = GPIO_Pin_1,
+    .min_on_s = 0.04f,              // 与时间比例最短接通时间一致
+    .min_off_s = 0.1f,              // 反向前等待电机停转, 触点灭弧
+};
+#endif
+
+// 升降台下限位开关: PB12 上拉输入, 按下接地
+static const exti_cfg_t home_switch_cfg = {
+    .port = GPIOB,
+    .pin = GPIO_Pin_12,
+    .gpio_rcc_mask = RCC_APB2Periph_GPIOB,
+    .gpio_rcc_bus = 2,
+    .gpio_mode = GPIO_Mode_IPU,
+    .trigger = EXTI_Trigger_Falling,
+    .nvic_preempt = 0,
+    .nvic_sub = 1,
 };
 
 static const can_cfg_t can_cfg = {
@@ -43,13 +216,42 @@ static const usart_cfg_t usart1_cfg = {
 };
 
 static const tim_cfg_t tim_cfg_table[TIM_COUNT] = {
+#if LIFT_DRIVE_PWM
+    [TIM_1] = {
+        .id = TIM_1,
+        .periph = TIM1,
+        .mode = TIM_MODE_OC_PWM,
+        .prescaler = 0,
+        .period = 3600 - 1,     // 72 MHz / 3600 = 20 kHz
+        .enable_irq = 0,
+        .cfg.oc_pwm = {
+            .channel = TIM_Channel_1,
+            .port = GPIOA,
+            .pin = GPIO_Pin_8,
+            .gpio_rcc_mask = RCC_APB2Periph_GPIOA,
+            .gpio_rcc_bus = 2,
+            .gpio_mode = GPIO_Mode_AF_PP,
+            .oc_mode = TIM_OCMode_PWM1,
+            .oc_polarity = TIM_OCPolarity_High,
+            .pulse = 0,
+            .output_state = TIM_OutputState_Enable,
+            .preload = 1,
+            .n_port = GPIOB,
+            .n_pin = GPIO_Pin_13,
+            .n_gpio_rcc_mask = RCC_APB2Periph_GPIOB,
+            .n_gpio_rcc_bus = 2,
+            .ocn_polarity = TIM_OCNPolarity_High,
+            .dead_time = 72,    // 1 us
+        },
+    },
+#endif
     [TIM_2] = {
         .id = TIM_2,
         .periph = TIM2,
         .mode = TIM_MODE_ENCODER,
         .prescaler = 0,
         .period = 65536 - 1,
-        .enable_irq = 0,
+        .enable_irq = 1,       // 溢出中断扩展计数位宽
         .nvic_preempt = 0,
         .nvic_sub = 0,
         .cfg.encoder = {
@@ -80,18 +282,41 @@ static const tim_cfg_t tim_cfg_table[TIM_COUNT] = {
     },
 };
 
+#if LIFT_DRIVE_PWM
+// H 桥: 桥臂 A = TIM1_CH1 (PA8) / TIM1_CH1N (PB13), 桥臂 B = PB0 上管 / PB1 下管
+static const motor_cfg_t motor_cfg = {
+    .tim = &tim_cfg_table[TIM_1],
+    .b_rcc_mask = RCC_APB2Periph_GPIOB,
+    .b_port = GPIOB,
+    .b_high_pin = GPIO_Pin_0,
+    .b_low_pin = GPIO_Pin_1,
+    .ramp_per_s = 2.0f,         // 0 -> 100% 用时 0.5 s
+};
+#endif
+
 can_t can;
 usart_t usart1;
 usart_t usart2;
 tim_t tick;
 
 Encoder lift_encoder;
+#if LIFT_DRIVE_PWM
+Motor lift_motor;
+#else
 Relay lift_relay;
+#endif
 Gripper gripper;
+LimitSwitch lift_home_switch;
 
-// ! ========================= 私 有 函 数 声 明 ========================= ! //
+bench_t bench_encoder;
+bench_t bench_smith;
+
+static int8_t _lift_dir = 0;                // 上次通知延迟测量的驱动方向
 
+// ! ========================= 私 有 函 数 声 明 ========================= ! //
 
+static int64_t _lift_read_pulses(void);
+static void _lift_dir_track(void);
 
 // ! ========================= 接 口 函 数 实 现 ========================= ! //
 
@@ -109,8 +334,13 @@ void a_board_init(void) {
 
     /* 创建对象 */
     lift_encoder = encoder_create();
+#if LIFT_DRIVE_PWM
+    lift_motor = motor_create();
+#else
     lift_relay = relay_create();
+#endif
     gripper = gripper_create();
+    lift_home_switch = limit_switch_create();
 
     /* HAL 初始化 */
     can_init(&can, &can_cfg);
@@ -118,17 +348,193 @@ void a_board_init(void) {
     tim_init(&tick, &tim_cfg_table[TIM_3]);
 
     /* 驱动初始化 */
-    lift_encoder.init(&lift_encoder, &tim_cfg_table[TIM_2], 10, ACTUAL_PULSE_PER_MM);
+    lift_encoder.init(&lift_encoder, &tim_cfg_table[TIM_2], TICK_PERIOD_MS, ACTUAL_PULSE_PER_MM);
+    lift_encoder.set_speed_mode(&lift_encoder, EncoderSpeedObserver, ENCODER_OBSERVER_BW_HZ);
+
+    /* 掉电参数: 有标定记录时覆盖编译期标定值 */
+    s_param_init(PARAM_FLASH_ADDR);
+    if(s_param_load() && (s_param_get()->valid & PARAM_VALID_ENC_SCALE)) {
+        lift_encoder.set_scale(&lift_encoder, s_param_get()->enc_ppm_up, s_param_get()->enc_ppm_down);
+    }
+    s_lift_limit_init(&lift_limit_cfg);
+    if(s_param_get()->valid & PARAM_VALID_LIMITS) {
+        s_lift_limit_set(s_param_get()->limit_min_mm, s_param_get()->limit_max_mm);
+    }
+#if LIFT_DRIVE_PWM
+    lift_motor.init(&lift_motor, &motor_cfg);
+#else
     lift_relay.init(&lift_relay, &relay_cfg);
+#endif
+    lift_home_switch.init(&lift_home_switch, &home_switch_cfg, 1, &lift_encoder);
     gripper.init(&gripper, &can, 0x01);
 
     /* 服务初始化 */
     s_delay_init(systick_get_ms, systick_is_timeout, dwt_get_us, dwt_is_timeout);
-    s_wireless_comms_init(&usart1, &lift_relay, &gripper);
+    s_bench_init(dwt_get_cycles);
+    s_bench_register(&bench_encoder, "encoder_update");
+    s_bench_register(&bench_smith, "lift_smith");
+    s_pid_bench_init(&lift_pid_cfg, &pid_bench_plant, TICK_PERIOD_MS / 1000.0f);
+    s_lift_monitor_init(&lift_monitor_cfg);
+    s_lift_coast_init(&lift_coast_cfg);
+#if LIFT_CTRL_CASCADE
+    // 串级: 调度与在线调参作用于位置环; 自整定结果为单环增益, 不加载
+    s_lift_ctrl_init(&lift_ctrl_cfg, &lift_cascade_pos_cfg, &lift_cascade_vel_cfg);
+    lift_gains_t base = { lift_cascade_pos_cfg.kp, lift_cascade_pos_cfg.ki, lift_cascade_pos_cfg.kd };
+#else
+    s_lift_ctrl_init(&lift_ctrl_cfg, &lift_pid_cfg, 0);
+    lift_gains_t base = { lift_pid_cfg.kp, lift_pid_cfg.ki, lift_pid_cfg.kd };
+    if(s_param_get()->valid & PARAM_VALID_PID_GAINS) {
+        base.kp = s_param_get()->pid_kp;
+        base.ki = s_param_get()->pid_ki;
+        base.kd = s_param_get()->pid_kd;
+        s_lift_ctrl_set_gains(base.kp, base.ki, base.kd);
+    }
+#endif
+    s_lift_gains_init(&lift_gains_cfg, &s_param_get()->gain_table, (s_param_get()->valid & PARAM_VALID_GAIN_TABLE) != 0);
+    s_lift_gains_set_base(&base);
+    s_lift_profile_init(&lift_profile_cfg);
+    s_step_resp_init(&step_resp_cfg);
+    s_lift_ident_init(&lift_ident_cfg);
+    s_lift_smith_init(&lift_smith_cfg);
+    if(s_param_get()->valid & PARAM_VALID_SMITH_MODEL) {
+        s_lift_smith_set_model(&s_param_get()->smith_model);
+    }
+    s_lift_ff_init(&lift_ff_cfg);
+    if(s_param_get()->valid & PARAM_VALID_FF_MODEL) {
+        s_lift_ff_set_model(&s_param_get()->ff_model);
+    }
+    s_lift_latency_init(dwt_get_cycles, _lift_read_pulses, CPU_FREQ_MHZ * 1000u);
+    s_wireless_comms_init(&usart1, a_board_lift_drive, &gripper);
 
     s_delay_ms(1000);
     printf("Board initialized!\r\n");
 }
 
+/**
+ * @brief   驱动升降台
+ * @param   u 指令 (-1 ~ 1, 正为上行); 继电器方式只取符号, PWM 方式为占空比
+ * @retval  None
+ */
+void a_board_lift_drive(float u) {
+#if LIFT_DRIVE_PWM
+    lift_motor.set_duty(&lift_motor, u);
+#else
+    if(u > 0.0f) {
+        lift_relay.set_dir(&lift_relay, RelayDirA);
+    }
+    else if(u < 0.0f) {
+        lift_relay.set_dir(&lift_relay, RelayDirB);
+    }
+    else {
+        lift_relay.stop(&lift_relay);
+    }
+#endif
+    _lift_dir_track();
+}
+
+/**
+ * @brief   立即停止升降台 (PWM 方式不经斜坡)
+ * @param   None
+ * @retval  None
+ */
+void a_board_lift_stop(void) {
+#if LIFT_DRIVE_PWM
+    lift_motor.stop(&lift_motor);
+#else
+    lift_relay.stop(&lift_relay);
+#endif
+    _lift_dir_track();
+}
+
+/**
+ * @brief   获取升降台当前驱动方向
+ * @param   None
+ * @retval  int8_t 1 上行 (计数增加), -1 下行, 0 停止
+ * @note    PWM 方式为占空比的符号: 占空比不为 0 即为驱动中, 小占空比下平台是否应当运动由调用方判断
+ */
+int8_t a_board_lift_dir(void) {
+#if LIFT_DRIVE_PWM
+    float duty = lift_motor.get_duty(&lift_motor);
+    if(duty > 0.0f) return 1;
+    if(duty < 0.0f) return -1;
+    return 0;
+#else
+    switch(lift_relay.get_dir(&lift_relay)) {
+        case RelayDirA:
+            return 1;
+        case RelayDirB:
+            return -1;
+        default:
+            return 0;
+    }
+#endif
+}
+
+/**
+ * @brief   升降台当前实际驱动输出
+ * @param   None
+ * @retval  float PWM 方式为占空比, 继电器方式为 1 / -1 / 0
+ * @note    用于 PID 无扰切换的初始输出
+ */
+float a_board_lift_output(void) {
+#if LIFT_DRIVE_PWM
+    return lift_motor.get_duty(&lift_motor);
+#else
+    return (float)a_board_lift_dir();
+#endif
+}
+
+/**
+ * @brief   升降台驱动周期处理 (每个控制周期调用一次)
+ * @param   None
+ * @retval  None
+ */
+void a_board_lift_update(void) {
+#if LIFT_DRIVE_PWM
+    lift_motor.update(&lift_motor, TICK_PERIOD_MS / 1000.0f);
+#else
+    lift_relay.update(&lift_relay, TICK_PERIOD_MS / 1000.0f);
+#endif
+    _lift_dir_track();
+}
+
+/**
+ * @brief   报告升降台驱动器寿命统计
+ * @param   None
+ * @retval  None
+ * @note    继电器方式输出 $LIFT:RELAY,<吸合次数>,<换向次数>,<推迟次数>#
+ */
+void a_board_lift_report(void) {
+#if LIFT_DRIVE_PWM
+    printf("$LIFT:RELAY,NA#");
+#else
+    relay_stats_t st;
+    lift_relay.get_stats(&lift_relay, &st);
+    printf("$LIFT:RELAY,%lu,%lu,%lu#", (unsigned long)st.actuations,
+        (unsigned long)st.reversals, (unsigned long)st.deferred);
+#endif
+}
+
 // ! ========================= 私 有 函 数 实 现 ========================= ! //
 
+/**
+ * @brief   读取升降台编码器实时累计脉冲数 (供延迟测量轮询)
+ * @param   None
+ * @retval  int64_t 脉冲数
+ */
+static int64_t _lift_read_pulses(void) {
+    return lift_encoder.get_pulses(&lift_encoder);
+}
+
+/**
+ * @brief   驱动方向实际改变时通知延迟测量
+ * @param   None
+ * @retval  None
+ * @note    继电器请求可能被推迟, 以实际输出为准, 在每次驱动操作后调用
+ */
+static void _lift_dir_track(void) {
+    int8_t dir = a_board_lift_dir();
+    if(dir == _lift_dir) return;
+    _lift_dir = dir;
+    s_lift_latency_command(dir);
+}
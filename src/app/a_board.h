@@ -10,31 +10,78 @@
 #include "timer.h"
 #include "systick.h"
 #include "dwt.h"
+#include "exti.h"
+#include "flash.h"
 
 #include "d_encoder.h"
 #include "d_relay.h"
+#include "d_motor.h"
 #include "d_gripper.h"
+#include "d_limit_switch.h"
 
+#include "s_bench.h"
 #include "s_delay.h"
+#include "s_lift_autotune.h"
+#include "s_lift_calib.h"
+#include "s_lift_coast.h"
+#include "s_lift_ctrl.h"
+#include "s_lift_ff.h"
+#include "s_lift_gains.h"
+#include "s_lift_ident.h"
+#include "s_lift_latency.h"
+#include "s_lift_limit.h"
+#include "s_lift_monitor.h"
+#include "s_lift_profile.h"
+#include "s_lift_queue.h"
+#include "s_lift_smith.h"
 #include "s_log.h"
+#include "s_param.h"
 #include "s_pid.h"
+#include "s_pid_bench.h"
+#include "s_step_resp.h"
 #include "s_wireless_comms.h"
 
 #include "a_fsm.h"
 
 // ! ========================= 接 口 变 量 / Typedef 声 明 ========================= ! //
 
+// 实际每毫米的脉冲数 (经测量校准; Flash 中无标定记录时使用)
+#define ACTUAL_PULSE_PER_MM     15.518f
+
+// 升降台驱动方式: 1 = H 桥 PWM (TIM1 互补输出, 复用继电器接口 PB0/PB1 作桥臂 B), 0 = 继电器
+#define LIFT_DRIVE_PWM          0
+
+// 升降台定位方式: 1 = PID 闭环 (继电器时间比例输出), 0 = 滑行预测提前断开
+#define LIFT_POS_CTRL_PID       1
+
+// PID 闭环结构: 1 = 串级 (位置环 -> 编码器速度环, 速度环每周期计算, 宜配合 PWM 驱动), 0 = 单环
+#define LIFT_CTRL_CASCADE       0
+
 extern can_t can;
 extern usart_t usart1;
 extern usart_t usart2;
 extern tim_t tick;
 
 extern Encoder lift_encoder;
+#if LIFT_DRIVE_PWM
+extern Motor lift_motor;
+#else
 extern Relay lift_relay;
+#endif
 extern Gripper gripper;
+extern LimitSwitch lift_home_switch;
+
+extern bench_t bench_encoder;
+extern bench_t bench_smith;
 
 // ! ========================= 接 口 函 数 声 明 ========================= ! //
 
 void a_board_init(void);
+void a_board_lift_drive(float u);
+void a_board_lift_stop(void);
+int8_t a_board_lift_dir(void);
+float a_board_lift_output(void);
+void a_board_lift_update(void);
+void a_board_lift_report(void);
 
 #endif
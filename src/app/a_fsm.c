@@ -8,7 +8,13 @@
  * ├──  NormalState (state_normal)
  * |    |
  * |    ├── IdleState (state_idle)
- * |    └── LiftMovingState (state_lift_moving)
+ * |    ├── LiftMovingState (state_lift_moving)
+ * |    ├── LiftJogState (state_lift_jog)
+ * |    ├── LiftCalibState (state_lift_calib)
+ * |    ├── LiftAutotuneState (state_lift_autotune)
+ * |    ├── LiftIdentState (state_lift_ident)
+ * |    ├── LiftFfIdentState (state_lift_ff_ident)
+ * |    └── LiftHomingState (state_lift_homing)
  * |
  * └──  ErrorState (state_error)
  */
@@ -24,6 +30,77 @@
 event_e cur_event = EVENT_NONE;
 State* cur_state = &state_idle;
 
+// 标定参数 (由请求带入, 进入标定状态时使用)
+static float _calib_span_mm = 0.0f;
+static uint8_t _calib_cycles = 0;
+
+// 定位死区: 停止后位置误差在此范围内视为到位
+#define LIFT_POS_BAND_MM        1.0f
+// 静止判定速度: 停车滑行结束前不重新判断是否到位
+#define LIFT_STILL_SPEED_MM_S   1.0f
+
+static bool _lift_tick = false;             // 编码器已在本周期更新, 供定位控制使用
+static uint32_t _ctrl_cycles = 0;           // 上次定位控制的 DWT 周期计数
+
+// 自整定参数
+#define TUNE_HYST_MM            0.5f        // 回差
+#define TUNE_RANGE_MM           20.0f       // 振荡允许偏离设定点的距离
+#define TUNE_CYCLES             4
+
+static LiftTuneRule_e _tune_rule = LiftTuneRuleTL;
+static float _tune_sp_mm = 0.0f;            // 振荡中心 (进入时的位置)
+
+// 定位超时: 基础时间 (起停与到位保持) + 行程 / 最低平均速度, 目标改变时重新计时
+#define MOVE_TIMEOUT_BASE_MS    5000u
+#define MOVE_TIMEOUT_MIN_MM_S   10.0f       // 轨迹最高速度的 1/3
+
+static uint32_t _move_start_ms = 0;         // 本段定位开始时间
+static uint32_t _move_limit_ms = 0;         // 本段定位允许时间
+static float _move_target_mm = 0.0f;        // 本段定位目标
+
+// 点动: 超过该时间未收到重复的点动命令则停止
+#define JOG_TIMEOUT_MS          500u
+
+static int8_t _jog_dir = 0;                 // 点动方向
+static uint32_t _jog_ms = 0;                // 最近一次点动命令时间
+static bool _jog_at_limit = false;          // 已在软限位处停止 (只报告一次)
+static bool _jog_hold = false;              // 点动结束, 待滑行停止后以实际位置为目标
+static float _jog_hold_mm = 0.0f;           // 点动结束时设置的目标
+static float _jog_target_mm = 0.0f;         // 进入点动时的目标 (变化即收到新目标)
+static bool _jog_to_auto = false;           // 点动直接切入定位
+
+// 回零参数
+#define HOME_BACKOFF_MM         5.0f        // 触发后上行离开开关的距离
+#define HOME_APPROACH_MM        10.0f       // 快速回零: 先全速下行到该高度再寻找开关
+#define HOME_FAST_WINDOW_MM     20.0f       // 快速回零: 越过预期零点该距离仍未触发则失败
+#define HOME_TIMEOUT_MS         60000u      // 回零总超时
+
+/**
+ * @brief   回零阶段
+ */
+typedef enum {
+    HomePreBackoff = 0,         // 开关已按下, 先上行离开
+    HomeApproach,               // 快速回零: 全速下行至零点附近
+    HomeSeek,                   // 下行寻找开关, 由中断锁存零点
+    HomeBackoff                 // 零点已确定, 上行离开开关
+} HomePhase_e;
+
+static bool _lift_homed = false;            // 是否已建立零点, 未回零时拒绝移动
+static bool _home_fast = false;             // 请求快速回零 (需已回零)
+static HomePhase_e _home_phase = HomePreBackoff;
+static float _home_phase_start_mm = 0.0f;   // 当前阶段起始位置
+static float _home_drift_mm = 0.0f;         // 重新回零时旧坐标系下的零点位置
+static uint32_t _home_start_ms = 0;
+
+// 航点队列执行状态
+static bool _wp_active = false;             // 当前目标来自航点队列
+static uint8_t _wp_run = 0;                 // 本次运动衔接的航点数 (目标为第 _wp_run - 1 个)
+static float _wp_dir = 1.0f;                // 本次运动方向
+static uint32_t _wp_dwell_start_ms = 0;     // 上一航点到达时间
+static uint32_t _wp_dwell_ms = 0;           // 上一航点停留时间
+
+static bool _param_dirty = false;           // 参数已修改, 待回到空闲状态时写入 Flash
+
 // ! ========================= 私 有 函 数 声 明 ========================= ! //
 
 static State* dispatch_event(State* state, event_e e);
@@ -31,6 +108,16 @@ static State* find_lca(State* s1, State* s2);
 static void exit_up_to(State* from, State* to);
 static void enter_down_to(State* from, State* to);
 static void execute_action(State* state);
+static void handle_lift_request(void);
+static void home_enter_phase(HomePhase_e phase);
+static void move_timer_start(float pos);
+static bool lift_driven(void);
+static void queue_start(float pos);
+static void queue_track(float pos);
+static void queue_arrive(void);
+static void queue_abort(void);
+static void param_save_deferred(void);
+static void param_flush(void);
 
 /**
  * @brief   正常状态
@@ -79,16 +166,120 @@ State state_lift_moving = {
     ._parent_ = &state_normal,
 };
 
+/**
+ * @brief   升降台点动状态
+ */
+static State* lift_jog_handle_event(event_e e);
+static void lift_jog_action(void);
+static void lift_jog_entry(void);
+static void lift_jog_exit(void);
+State state_lift_jog = {
+    .handle_event = lift_jog_handle_event,
+    .action = lift_jog_action,
+    .entry = lift_jog_entry,
+    .exit = lift_jog_exit,
+
+    .name_ = "lift_jog",
+    ._parent_ = &state_normal,
+};
+
+/**
+ * @brief   升降台编码器标定状态
+ */
+static State* lift_calib_handle_event(event_e e);
+static void lift_calib_action(void);
+static void lift_calib_entry(void);
+static void lift_calib_exit(void);
+State state_lift_calib = {
+    .handle_event = lift_calib_handle_event,
+    .action = lift_calib_action,
+    .entry = lift_calib_entry,
+    .exit = lift_calib_exit,
+
+    .name_ = "lift_calib",
+    ._parent_ = &state_normal,
+};
+
+/**
+ * @brief   升降台自整定状态
+ */
+static State* lift_autotune_handle_event(event_e e);
+static void lift_autotune_action(void);
+static void lift_autotune_entry(void);
+static void lift_autotune_exit(void);
+State state_lift_autotune = {
+    .handle_event = lift_autotune_handle_event,
+    .action = lift_autotune_action,
+    .entry = lift_autotune_entry,
+    .exit = lift_autotune_exit,
+
+    .name_ = "lift_autotune",
+    ._parent_ = &state_normal,
+};
+
+/**
+ * @brief   升降台阶跃辨识状态
+ */
+static State* lift_ident_handle_event(event_e e);
+static void lift_ident_action(void);
+static void lift_ident_entry(void);
+static void lift_ident_exit(void);
+State state_lift_ident = {
+    .handle_event = lift_ident_handle_event,
+    .action = lift_ident_action,
+    .entry = lift_ident_entry,
+    .exit = lift_ident_exit,
+
+    .name_ = "lift_ident",
+    ._parent_ = &state_normal,
+};
+
+/**
+ * @brief   升降台前馈辨识状态
+ */
+static State* lift_ff_ident_handle_event(event_e e);
+static void lift_ff_ident_action(void);
+static void lift_ff_ident_entry(void);
+static void lift_ff_ident_exit(void);
+State state_lift_ff_ident = {
+    .handle_event = lift_ff_ident_handle_event,
+    .action = lift_ff_ident_action,
+    .entry = lift_ff_ident_entry,
+    .exit = lift_ff_ident_exit,
+
+    .name_ = "lift_ff_ident",
+    ._parent_ = &state_normal,
+};
+
+/**
+ * @brief   升降台回零状态
+ */
+static State* lift_homing_handle_event(event_e e);
+static void lift_homing_action(void);
+static void lift_homing_entry(void);
+static void lift_homing_exit(void);
+State state_lift_homing = {
+    .handle_event = lift_homing_handle_event,
+    .action = lift_homing_action,
+    .entry = lift_homing_entry,
+    .exit = lift_homing_exit,
+
+    .name_ = "lift_homing",
+    ._parent_ = &state_normal,
+};
+
 /**
  * @brief   错误状态
  */
 static State* error_handle_event(event_e e);
+static void error_action(void);
 static void error_entry(void);
+static void error_exit(void);
 State state_error = {
     .handle_event = error_handle_event,
-    .action = 0,
+    .action = error_action,
     .entry = error_entry,
-    .exit = 0,
+    .exit = error_exit,
 
     .name_ = "error",
     ._parent_ = 0,
@@ -106,8 +297,12 @@ void a_fsm_process(void) {
         return;
     }
 
+    // 取出事件后立即清除: 动作函数中新触发的事件留到下一轮处理, 未被处理的事件直接丢弃
+    event_e e = cur_event;
+    cur_event = EVENT_NONE;
+
     // 根据当前事件和状态获取下一个状态
-    State* next_state = dispatch_event(cur_state, cur_event);
+    State* next_state = dispatch_event(cur_state, e);
     if(next_state != cur_state) {
         // 找到最近公共祖先状态
         State* lca = find_lca(cur_state, next_state);
@@ -116,9 +311,8 @@ void a_fsm_process(void) {
         exit_up_to(cur_state, lca);
         enter_down_to(lca, next_state);
 
-        // 状态转移并清除事件
+        // 状态转移
         cur_state = next_state;
-        cur_event = EVENT_NONE;
     }
 
     // 状态持续动作
@@ -128,8 +322,11 @@ void a_fsm_process(void) {
 /**
  * @brief   触发事件
  * @param   e 事件
+ * @note    只有一个事件槽: 已挂起的 EVENT_ERROR 不被覆盖 (如子状态动作中定位超时 / 监测触发错误后,
+ *          同一轮 normal_action 处理的请求又触发事件), 保证错误状态总能锁存
  */
 void a_fsm_trigger_event(event_e e) {
+    if(cur_event == EVENT_ERROR) return;
     cur_event = e;
 }
 
@@ -238,6 +435,91 @@ static void execute_action(State* state) {
     }
 }
 
+/**
+ * @brief   将通信服务的升降台请求转换为事件或直接处理
+ */
+static void handle_lift_request(void) {
+    lift_req_t req = lift_req;
+    lift_req.req = LiftReqNone;
+
+    switch(req.req) {
+        case LiftReqStop:
+            // 停止同时放弃航点队列, 停在当前位置
+            queue_abort();
+            lift_target_pos_mm = lift_encoder.get_position(&lift_encoder);
+            a_fsm_trigger_event(EVENT_LIFT_STOP);
+            break;
+        case LiftReqCalib:
+            _calib_span_mm = req.args[0];
+            _calib_cycles = (uint8_t)req.args[1];
+            a_fsm_trigger_event(EVENT_LIFT_CALIB);
+            break;
+        case LiftReqHome:
+            _home_fast = req.args[0] != 0.0f;
+            a_fsm_trigger_event(EVENT_LIFT_HOME);
+            break;
+        case LiftReqCalibMark:
+            s_lift_calib_mark(lift_encoder.get_pulses(&lift_encoder), systick_get_ms());
+            break;
+        case LiftReqReport:
+            a_board_lift_report();
+            break;
+        case LiftReqAutotune:
+#if LIFT_CTRL_CASCADE
+            // 继电反馈整定给出的是单环增益
+            printf("$LIFT:TUNE_UNSUPPORTED#");
+#else
+            _tune_rule = (req.args[0] == 0.0f) ? LiftTuneRuleZN : LiftTuneRuleTL;
+            a_fsm_trigger_event(EVENT_LIFT_AUTOTUNE);
+#endif
+            break;
+        case LiftReqIdent:
+            a_fsm_trigger_event(EVENT_LIFT_IDENT);
+            break;
+        case LiftReqFfIdent:
+            a_fsm_trigger_event(EVENT_LIFT_FF_IDENT);
+            break;
+        case LiftReqJog:
+            _jog_dir = (req.args[0] > 0.0f) ? 1 : -1;
+            _jog_ms = systick_get_ms();
+            a_fsm_trigger_event(EVENT_LIFT_JOG);
+            break;
+        case LiftReqLimits:
+            if(s_lift_limit_set(req.args[0], req.args[1])) {
+                // 立即生效: 当前目标与未执行的航点钳位到新限位内 (运动中按新目标重新规划)
+                lift_target_pos_mm = s_lift_limit_clamp(lift_target_pos_mm);
+                s_lift_queue_clamp(req.args[0], req.args[1]);
+
+                param_t* param = s_param_get();
+                param->limit_min_mm = req.args[0];
+                param->limit_max_mm = req.args[1];
+                param->valid |= PARAM_VALID_LIMITS;
+                param_save_deferred();
+                printf("$LIFT:LIMITS,%.2f,%.2f#", req.args[0], req.args[1]);
+            }
+            else {
+                printf("$LIFT:LIMITS_INVALID#");
+            }
+            break;
+        case LiftReqGainsSave: {
+            param_t* param = s_param_get();
+            if(s_lift_gains_enabled()) param->valid |= PARAM_VALID_GAIN_TABLE;
+            else param->valid &= ~PARAM_VALID_GAIN_TABLE;
+            param_save_deferred();
+            printf("$PID:SCHED_SAVED,%d#", (int)s_lift_gains_enabled());
+            break;
+        }
+        case LiftReqPidBench:
+            // 对比测试阻塞数十毫秒, 运动中不能运行
+            if(cur_state == &state_idle) s_pid_bench_execute();
+            else s_pid_bench_reject();
+            break;
+        case LiftReqNone:
+        default:
+            break;
+    }
+}
+
 /**
  * @brief   正常状态事件处理函数
  * @param   e 事件
@@ -257,10 +539,27 @@ static State* normal_handle_event(event_e e) {
  */
 static void normal_action(void) {
     s_wireless_comms_process();
+    handle_lift_request();
+    s_lift_latency_poll();
 
     if(tick.flag) {
         tick.flag = 0;
+        s_bench_begin(&bench_encoder);
         lift_encoder.update(&lift_encoder);
+        s_bench_end(&bench_encoder);
+
+        _lift_tick = true;
+        a_board_lift_update();
+
+        s_lift_coast_update(a_board_lift_dir(), lift_encoder.get_position(&lift_encoder),
+            lift_encoder.get_speed(&lift_encoder));
+
+        LiftFault_e fault = s_lift_monitor_update(a_board_lift_dir(), lift_driven(), lift_encoder.get_pulses(&lift_encoder));
+        if(fault != LiftFaultNone) {
+            a_board_lift_stop();
+            printf("$LIFT:FAULT,%d#", (int)fault);
+            a_fsm_trigger_event(EVENT_ERROR);
+        }
     }
 }
 
@@ -273,6 +572,18 @@ static State* idle_handle_event(event_e e) {
     switch(e) {
         case EVENT_LIFT_MOVE:
             return &state_lift_moving;
+        case EVENT_LIFT_CALIB:
+            return &state_lift_calib;
+        case EVENT_LIFT_HOME:
+            return &state_lift_homing;
+        case EVENT_LIFT_JOG:
+            return &state_lift_jog;
+        case EVENT_LIFT_AUTOTUNE:
+            return &state_lift_autotune;
+        case EVENT_LIFT_IDENT:
+            return &state_lift_ident;
+        case EVENT_LIFT_FF_IDENT:
+            return &state_lift_ff_ident;
         default:
             return 0;
     }
@@ -282,9 +593,32 @@ static State* idle_handle_event(event_e e) {
  * @brief   空闲状态持续动作函数
  */
 static void idle_action(void) {
-    if(fabsf(lift_target_pos_mm - lift_encoder.get_position(&lift_encoder)) > 5.0f) {
-        a_fsm_trigger_event(EVENT_LIFT_MOVE);
+    float current = lift_encoder.get_position(&lift_encoder);
+
+    param_flush();
+
+    // 航点队列: 上一航点停留结束后取下一段
+    if(!_wp_active && s_lift_queue_count() > 0 && systick_get_ms() - _wp_dwell_start_ms >= _wp_dwell_ms) {
+        queue_start(current);
+    }
+
+    // 点动结束且滑行停止: 以实际停止位置为目标, 不回到点动前的目标 (其间收到新目标则不覆盖)
+    if(_jog_hold && s_lift_coast_settled() && fabsf(lift_encoder.get_speed(&lift_encoder)) <= LIFT_STILL_SPEED_MM_S) {
+        _jog_hold = false;
+        if(lift_target_pos_mm == _jog_hold_mm) lift_target_pos_mm = current;
     }
+
+    if(fabsf(lift_target_pos_mm - current) <= LIFT_POS_BAND_MM) return;
+    if(!s_lift_coast_settled() || fabsf(lift_encoder.get_speed(&lift_encoder)) > LIFT_STILL_SPEED_MM_S) return;
+
+    // 未建立零点时位置无意义, 拒绝移动
+    if(!_lift_homed) {
+        lift_target_pos_mm = current;
+        printf("$LIFT:NOT_HOMED#");
+        return;
+    }
+
+    a_fsm_trigger_event(EVENT_LIFT_MOVE);
 }
 
 /**
@@ -305,6 +639,19 @@ static State* lift_moving_handle_event(event_e e) {
  * @brief   升降台移动状态进入动作函数
  */
 static void lift_moving_entry(void) {
+    float pos = lift_encoder.get_position(&lift_encoder);
+    float speed = lift_encoder.get_speed(&lift_encoder);
+    // 从点动直接切入时平台仍在运动: 轨迹从当前速度开始, PID 从当前驱动输出接续
+    s_lift_profile_reset(pos, speed);
+    s_lift_profile_set_target(lift_target_pos_mm);
+    const lift_gains_t* g = s_lift_gains_reset(lift_target_pos_mm >= pos ? 1 : -1, pos);
+    s_lift_ctrl_set_gains(g->kp, g->ki, g->kd);
+    s_lift_ctrl_start(lift_target_pos_mm, pos, speed, s_lift_profile_vel(), a_board_lift_output());
+    s_lift_smith_reset(speed);
+    s_step_resp_start(lift_target_pos_mm, pos);
+    move_timer_start(pos);
+    _ctrl_cycles = dwt_get_cycles();
+    _lift_tick = false;
     printf("$LIFT:START#");
 }
 
@@ -317,23 +664,640 @@ static void lift_moving_exit(void) {
 
 /**
  * @brief   升降台移动状态动作函数
+ * @note    PID 方式: 每个控制周期推进一次轨迹, PID 以 DWT 实测 dt 跟踪参考位置,
+ *          反馈取预测位置: 有辨识模型时为 Smith 预估, 否则按起动延迟外推;
+ *          前馈按轨迹参考速度 / 加速度计算 (有前馈模型时含重力与摩擦);
+ *          运动中目标改变时从当前参考状态重新规划; 轨迹结束且到位后报告统计并回到空闲;
+ *          滑行预测方式: 剩余距离不大于预测滑行距离时提前断开继电器, 由惯性滑行到目标;
+ *          超过允许时间仍未到位则停车并进入错误状态
  */
 static void lift_moving_action(void) {
-    float target = lift_target_pos_mm;
-    float current = lift_encoder.get_position(&lift_encoder);
+    if(_wp_active) queue_track(lift_encoder.get_position(&lift_encoder));
 
-    if(target - current > 5.0f) {
-        lift_relay.set_dir(&lift_relay, RelayDirA);
+    if(lift_target_pos_mm != _move_target_mm) {
+        move_timer_start(lift_encoder.get_position(&lift_encoder));
     }
-    else if(target - current < -5.0f) {
-        lift_relay.set_dir(&lift_relay, RelayDirB);
+    if(systick_get_ms() - _move_start_ms > _move_limit_ms) {
+        a_board_lift_stop();
+        printf("$LIFT:MOVE_TIMEOUT,%.2f,%.2f#", lift_target_pos_mm, lift_encoder.get_position(&lift_encoder));
+        a_fsm_trigger_event(EVENT_ERROR);
+        return;
+    }
+
+#if LIFT_POS_CTRL_PID
+    if(!_lift_tick) return;
+    _lift_tick = false;
+
+    uint32_t now = dwt_get_cycles();
+    float dt_s = (float)(now - _ctrl_cycles) / (CPU_FREQ_MHZ * 1000000.0f);
+    _ctrl_cycles = now;
+
+    if(lift_target_pos_mm != s_lift_profile_target()) {
+        s_lift_profile_set_target(lift_target_pos_mm);
+    }
+    bool done = s_lift_profile_update();
+
+    // 预测位置: 指令在纯滞后之后才生效, 以预测位置计算使指令提前发出
+    float meas = lift_encoder.get_position(&lift_encoder);
+    float speed = lift_encoder.get_speed(&lift_encoder);
+    float pos;
+    if(s_lift_smith_enabled()) {
+        // 模型输入为上一周期实际施加的驱动 (继电器为时间比例后的方向)
+        s_bench_begin(&bench_smith);
+        pos = s_lift_smith_update(meas, speed, a_board_lift_output(), dt_s);
+        s_bench_end(&bench_smith);
     }
     else {
-        lift_relay.stop(&lift_relay);
+        pos = meas + speed * s_lift_latency_lead_s(speed >= 0.0f ? 1 : -1);
+    }
+
+    // 增益调度: 按参考速度方向 / 负载 / 位置取增益 (切换时增益按时间过渡)
+    if(s_lift_gains_enabled()) {
+        const lift_gains_t* g = s_lift_gains_update(s_lift_profile_vel(), pos, dt_s);
+        s_lift_ctrl_set_gains(g->kp, g->ki, g->kd);
+    }
+
+    a_board_lift_drive(s_lift_ctrl_update(lift_target_pos_mm, s_lift_profile_pos(), s_lift_profile_vel(), s_lift_profile_acc(),
+        pos, speed, dt_s));
+    // 阶跃响应按实测位置与 PID 输出记录
+    s_step_resp_sample(lift_target_pos_mm, meas, s_lift_ctrl_duty(), dt_s);
+
+    if(done && s_lift_ctrl_settled()) {
+        lift_ctrl_stats_t st;
+        s_lift_ctrl_stats(&st);
+        a_board_lift_stop();
+        printf("$LIFT:SETTLED,%.2f,%.2f,%.2f,%.2f#", st.settle_s, st.overshoot_mm, st.rms_err_mm, st.final_err_mm);
+        step_resp_result_t sr;
+        s_step_resp_finish(&sr);
+        printf("$STEP:%.2f,%.3f,%.2f,%.3f,%.3f,%.3f#", sr.step_mm, sr.rise_s, sr.overshoot_pct, sr.settle_s, sr.sse_mm, sr.iae);
+        queue_arrive();
+        a_fsm_trigger_event(EVENT_LIFT_STOP);
+    }
+#else
+    float err = lift_target_pos_mm - lift_encoder.get_position(&lift_encoder);
+    int8_t dir = err > 0.0f ? 1 : -1;
+    float coast = s_lift_coast_predict(dir, lift_encoder.get_speed(&lift_encoder), lift_encoder.get_accel(&lift_encoder));
+
+    if(fabsf(err) <= LIFT_POS_BAND_MM || fabsf(err) <= coast) {
+        a_board_lift_stop();
+        queue_arrive();
+        a_fsm_trigger_event(EVENT_LIFT_STOP);
+    }
+    else {
+        a_board_lift_drive((float)dir);
+    }
+#endif
+}
+
+/**
+ * @brief   升降台点动状态事件处理函数
+ * @param   e 事件
+ * @retval  下一个状态
+ * @note    点动中重复的点动命令只刷新方向与时间 (已在请求处理中完成);
+ *          点动中收到新目标时不停车, 直接切入定位 (手动 -> 自动无扰切换)
+ */
+static State* lift_jog_handle_event(event_e e) {
+    switch(e) {
+        case EVENT_LIFT_STOP:
+            return &state_idle;
+        case EVENT_LIFT_MOVE:
+            return &state_lift_moving;
+        default:
+            return 0;
+    }
+}
+
+/**
+ * @brief   升降台点动状态进入动作函数
+ */
+static void lift_jog_entry(void) {
+    _jog_at_limit = false;
+    _jog_hold = false;
+    _jog_to_auto = false;
+    _jog_target_mm = lift_target_pos_mm;
+}
+
+/**
+ * @brief   升降台点动状态退出动作函数
+ */
+static void lift_jog_exit(void) {
+    if(_jog_to_auto) return;            // 切入定位: 保持驱动与新目标
+
+    a_board_lift_stop();
+    lift_target_pos_mm = lift_encoder.get_position(&lift_encoder);
+    _jog_hold_mm = lift_target_pos_mm;
+    _jog_hold = true;
+}
+
+/**
+ * @brief   升降台点动状态动作函数
+ * @note    超时未刷新则停止; 已回零时按软限位与减速区限制驱动, 未回零时位置无意义, 只受超时保护
+ */
+static void lift_jog_action(void) {
+    if(systick_get_ms() - _jog_ms > JOG_TIMEOUT_MS) {
+        printf("$LIFT:JOG_TIMEOUT#");
         a_fsm_trigger_event(EVENT_LIFT_STOP);
+        return;
+    }
+
+    // 新目标 ($LIFT_SET): 已回零时切入定位
+    if(_lift_homed && lift_target_pos_mm != _jog_target_mm) {
+        _jog_to_auto = true;
+        a_fsm_trigger_event(EVENT_LIFT_MOVE);
+        return;
+    }
+
+    float u = 1.0f;
+    if(_lift_homed) {
+        float pos = lift_encoder.get_position(&lift_encoder);
+        u = s_lift_limit_drive(pos, lift_encoder.get_speed(&lift_encoder), _jog_dir);
+
+        float lo, hi;
+        s_lift_limit_get(&lo, &hi);
+        bool at_limit = (_jog_dir > 0) ? (pos >= hi) : (pos <= lo);
+        if(at_limit && !_jog_at_limit) printf("$LIFT:LIMIT#");
+        _jog_at_limit = at_limit;
+    }
+
+    a_board_lift_drive((float)_jog_dir * u);
+}
+
+/**
+ * @brief   升降台编码器标定状态事件处理函数
+ * @param   e 事件
+ * @retval  下一个状态
+ */
+static State* lift_calib_handle_event(event_e e) {
+    switch(e) {
+        case EVENT_LIFT_STOP:
+            return &state_idle;
+        default:
+            return 0;
     }
 }
 
+/**
+ * @brief   升降台编码器标定状态进入动作函数
+ */
+static void lift_calib_entry(void) {
+    queue_abort();
+    s_lift_calib_start(_calib_span_mm, _calib_cycles, ACTUAL_PULSE_PER_MM,
+        lift_encoder.get_pulses(&lift_encoder), systick_get_ms());
+    printf("$LIFT:CAL_START#");
+}
+
+/**
+ * @brief   升降台编码器标定状态退出动作函数
+ */
+static void lift_calib_exit(void) {
+    a_board_lift_stop();
+    s_lift_calib_abort();
+
+    // 标定期间的位置变化不应触发自动移动
+    lift_target_pos_mm = lift_encoder.get_position(&lift_encoder);
+}
+
+/**
+ * @brief   升降台编码器标定状态动作函数
+ * @note    按标定服务给出的方向往返运行; 完成后写入编码器与 Flash
+ */
+static void lift_calib_action(void) {
+    int8_t dir = s_lift_calib_update(lift_encoder.get_pulses(&lift_encoder), systick_get_ms());
+
+    if(dir > 0) {
+        a_board_lift_drive(1.0f);
+        return;
+    }
+    if(dir < 0) {
+        a_board_lift_drive(-1.0f);
+        return;
+    }
+
+    a_board_lift_stop();
+
+    lift_calib_result_t res;
+    if(s_lift_calib_result(&res)) {
+        lift_encoder.set_scale(&lift_encoder, res.ppm_up, res.ppm_down);
+
+        param_t* param = s_param_get();
+        param->enc_ppm_up = res.ppm_up;
+        param->enc_ppm_down = res.ppm_down;
+        param->valid |= PARAM_VALID_ENC_SCALE;
+        if(!s_param_save()) {
+            s_log_error("param save failed");
+        }
+
+        printf("$LIFT:CAL,%.4f,%.4f,%.4f,%.4f#", res.ppm_up, res.ppm_down, res.spread_up, res.spread_down);
+    }
+    else {
+        printf("$LIFT:CAL_FAIL,%d#", (int)s_lift_calib_error());
+    }
+
+    a_fsm_trigger_event(EVENT_LIFT_STOP);
+}
+
+/**
+ * @brief   升降台自整定状态事件处理函数
+ * @param   e 事件
+ * @retval  下一个状态
+ */
+static State* lift_autotune_handle_event(event_e e) {
+    switch(e) {
+        case EVENT_LIFT_STOP:
+            return &state_idle;
+        default:
+            return 0;
+    }
+}
+
+/**
+ * @brief   升降台自整定状态进入动作函数
+ * @note    以当前位置为振荡中心, 振荡范围不超出软限位; 未回零时拒绝
+ */
+static void lift_autotune_entry(void) {
+    queue_abort();
+    _tune_sp_mm = lift_encoder.get_position(&lift_encoder);
+
+    float lo, hi;
+    s_lift_limit_get(&lo, &hi);
+    if(lo < _tune_sp_mm - TUNE_RANGE_MM) lo = _tune_sp_mm - TUNE_RANGE_MM;
+    if(hi > _tune_sp_mm + TUNE_RANGE_MM) hi = _tune_sp_mm + TUNE_RANGE_MM;
+
+    s_lift_autotune_start(_tune_sp_mm, TUNE_HYST_MM, 1.0f, TUNE_CYCLES, _tune_rule, lo, hi, systick_get_ms());
+    printf("$LIFT:TUNE_START#");
+    if(!_lift_homed) {
+        printf("$LIFT:NOT_HOMED#");
+        s_lift_autotune_abort();
+    }
+}
+
+/**
+ * @brief   升降台自整定状态退出动作函数
+ */
+static void lift_autotune_exit(void) {
+    a_board_lift_stop();
+    s_lift_autotune_abort();
+
+    // 回到振荡中心
+    lift_target_pos_mm = _tune_sp_mm;
+}
+
+/**
+ * @brief   升降台自整定状态动作函数
+ * @note    每个控制周期按整定服务给出的方向开关驱动; 成功后更新位置 PID 增益并写入 Flash
+ */
+static void lift_autotune_action(void) {
+    if(!_lift_tick) return;
+    _lift_tick = false;
+
+    int8_t dir = s_lift_autotune_update(lift_encoder.get_position(&lift_encoder), systick_get_ms());
+    if(dir != 0) {
+        a_board_lift_drive((float)dir);
+        return;
+    }
+
+    a_board_lift_stop();
+
+    lift_tune_result_t res;
+    if(s_lift_autotune_result(&res)) {
+        // 整定结果作为基准增益; 已启用增益调度时下次定位仍按调度表
+        lift_gains_t base = { res.kp, res.ki, res.kd };
+        s_lift_gains_set_base(&base);
+        s_lift_ctrl_set_gains(res.kp, res.ki, res.kd);
+
+        param_t* param = s_param_get();
+        param->pid_kp = res.kp;
+        param->pid_ki = res.ki;
+        param->pid_kd = res.kd;
+        param->valid |= PARAM_VALID_PID_GAINS;
+        if(!s_param_save()) {
+            s_log_error("param save failed");
+        }
+
+        printf("$LIFT:TUNE,%.4f,%.3f,%.2f,%.4f,%.4f,%.4f#", res.ku, res.tu_s, res.amp_mm, res.kp, res.ki, res.kd);
+    }
+    else {
+        printf("$LIFT:TUNE_FAIL,%d#", (int)s_lift_autotune_error());
+    }
+
+    a_fsm_trigger_event(EVENT_LIFT_STOP);
+}
+
+/**
+ * @brief   升降台阶跃辨识状态事件处理函数
+ * @param   e 事件
+ * @retval  下一个状态
+ */
+static State* lift_ident_handle_event(event_e e) {
+    switch(e) {
+        case EVENT_LIFT_STOP:
+            return &state_idle;
+        default:
+            return 0;
+    }
+}
+
+/**
+ * @brief   升降台阶跃辨识状态进入动作函数
+ * @note    先上行后下行, 上方需留出一个阶跃的行程; 未回零时拒绝
+ */
+static void lift_ident_entry(void) {
+    queue_abort();
+    float lo, hi;
+    s_lift_limit_get(&lo, &hi);
+    s_lift_ident_start(lift_encoder.get_position(&lift_encoder), hi);
+    _ctrl_cycles = dwt_get_cycles();
+    _lift_tick = false;
+    printf("$LIFT:IDENT_START#");
+    if(!_lift_homed) {
+        printf("$LIFT:NOT_HOMED#");
+        s_lift_ident_abort();
+    }
+}
+
+/**
+ * @brief   升降台阶跃辨识状态退出动作函数
+ */
+static void lift_ident_exit(void) {
+    a_board_lift_stop();
+    s_lift_ident_abort();
+
+    // 试验期间的位置变化不应触发自动移动
+    lift_target_pos_mm = lift_encoder.get_position(&lift_encoder);
+}
+
+/**
+ * @brief   升降台阶跃辨识状态动作函数
+ * @note    每个控制周期按辨识服务给出的指令驱动 (DWT 实测 dt); 成功后设置预估器模型并写入 Flash
+ */
+static void lift_ident_action(void) {
+    if(!_lift_tick) return;
+    _lift_tick = false;
+
+    uint32_t now = dwt_get_cycles();
+    float dt_s = (float)(now - _ctrl_cycles) / (CPU_FREQ_MHZ * 1000000.0f);
+    _ctrl_cycles = now;
+
+    if(s_lift_ident_status() == LiftIdentRunning) {
+        float u = s_lift_ident_update(lift_encoder.get_position(&lift_encoder), dt_s);
+        if(s_lift_ident_status() == LiftIdentRunning) {
+            a_board_lift_drive(u);
+            return;
+        }
+    }
+
+    a_board_lift_stop();
+
+    lift_ident_result_t res;
+    if(s_lift_ident_result(&res) && s_lift_smith_set_model(&res.model)) {
+        param_t* param = s_param_get();
+        param->smith_model = res.model;
+        param->valid |= PARAM_VALID_SMITH_MODEL;
+        if(!s_param_save()) {
+            s_log_error("param save failed");
+        }
+
+        printf("$LIFT:IDENT,%.2f,%.3f,%.3f,%.2f,%.3f,%.3f,%.2f,%.3f,%.3f#", res.model.k_mm_s, res.model.tau_s, res.model.dead_s,
+            res.dir[0].k_mm_s, res.dir[0].tau_s, res.dir[0].dead_s, res.dir[1].k_mm_s, res.dir[1].tau_s, res.dir[1].dead_s);
+    }
+    else {
+        printf("$LIFT:IDENT_FAIL,%d#", (int)s_lift_ident_error());
+    }
+
+    a_fsm_trigger_event(EVENT_LIFT_STOP);
+}
+
+/**
+ * @brief   升降台前馈辨识状态事件处理函数
+ */
+static State* lift_ff_ident_handle_event(event_e e) {
+    switch(e) {
+        case EVENT_LIFT_STOP:
+            return &state_idle;
+        default:
+            return 0;
+    }
+}
+
+/**
+ * @brief   升降台前馈辨识状态进入动作函数
+ * @note    上下交替, 上方需留出单段最大行程; 惯性项取阶跃辨识模型的时间常数 (无模型时为 0); 未回零时拒绝
+ */
+static void lift_ff_ident_entry(void) {
+    queue_abort();
+    float lo, hi;
+    s_lift_limit_get(&lo, &hi);
+    const lift_fopdt_t* m = s_lift_smith_model();
+    s_lift_ff_ident_start(lift_encoder.get_position(&lift_encoder), hi, m ? m->tau_s : 0.0f);
+    _ctrl_cycles = dwt_get_cycles();
+    _lift_tick = false;
+    printf("$LIFT:FF_IDENT_START#");
+    if(!_lift_homed) {
+        printf("$LIFT:NOT_HOMED#");
+        s_lift_ff_ident_abort();
+    }
+}
+
+/**
+ * @brief   升降台前馈辨识状态退出动作函数
+ */
+static void lift_ff_ident_exit(void) {
+    a_board_lift_stop();
+    s_lift_ff_ident_abort();
+
+    // 试验期间的位置变化不应触发自动移动
+    lift_target_pos_mm = lift_encoder.get_position(&lift_encoder);
+}
+
+/**
+ * @brief   升降台前馈辨识状态动作函数
+ * @note    每个控制周期按辨识服务给出的占空比驱动, 经与定位相同的时间比例输出;
+ *          成功后启用前馈模型并写入 Flash
+ */
+static void lift_ff_ident_action(void) {
+    if(!_lift_tick) return;
+    _lift_tick = false;
+
+    uint32_t now = dwt_get_cycles();
+    float dt_s = (float)(now - _ctrl_cycles) / (CPU_FREQ_MHZ * 1000000.0f);
+    _ctrl_cycles = now;
+
+    if(s_lift_ff_ident_status() == LiftFfIdentRunning) {
+        float u = s_lift_ff_ident_update(lift_encoder.get_position(&lift_encoder), lift_encoder.get_speed(&lift_encoder), dt_s);
+        if(s_lift_ff_ident_status() == LiftFfIdentRunning) {
+            a_board_lift_drive(s_lift_ctrl_output(u));
+            return;
+        }
+    }
+
+    a_board_lift_stop();
+
+    lift_ff_model_t m;
+    if(s_lift_ff_ident_result(&m) && s_lift_ff_set_model(&m)) {
+        param_t* param = s_param_get();
+        param->ff_model = m;
+        param->valid |= PARAM_VALID_FF_MODEL;
+        if(!s_param_save()) {
+            s_log_error("param save failed");
+        }
+
+        printf("$LIFT:FF_IDENT,%.3f,%.3f,%.3f,%.3f,%.4f,%.4f,%.5f#", m.gravity, m.coulomb, m.breakaway[0], m.breakaway[1],
+            m.viscous[0], m.viscous[1], m.inertia);
+    }
+    else {
+        printf("$LIFT:FF_IDENT_FAIL,%d#", (int)s_lift_ff_ident_error());
+    }
+
+    a_fsm_trigger_event(EVENT_LIFT_STOP);
+}
+
+/**
+ * @brief   升降台回零状态事件处理函数
+ * @param   e 事件
+ * @retval  下一个状态
+ */
+static State* lift_homing_handle_event(event_e e) {
+    switch(e) {
+        case EVENT_LIFT_STOP:
+            return &state_idle;
+        default:
+            return 0;
+    }
+}
+
+/**
+ * @brief   升降台回零状态进入动作函数
+ * @note    快速回零仅在已有零点时生效, 否则退化为完整回零
+ */
+static void lift_homing_entry(void) {
+    queue_abort();
+    _home_fast = _home_fast && _lift_homed;
+    _home_drift_mm = 0.0f;
+    _home_start_ms = systick_get_ms();
+
+    if(lift_home_switch.is_pressed(&lift_home_switch)) {
+        home_enter_phase(HomePreBackoff);
+    }
+    else {
+        home_enter_phase(_home_fast ? HomeApproach : HomeSeek);
+    }
+    printf("$LIFT:HOME_START#");
+}
+
+/**
+ * @brief   升降台回零状态退出动作函数
+ */
+static void lift_homing_exit(void) {
+    a_board_lift_stop();
+    lift_target_pos_mm = lift_encoder.get_position(&lift_encoder);
+}
+
+/**
+ * @brief   升降台回零状态动作函数
+ * @note    零点取开关触发沿在中断中锁存的脉冲数, 与主循环轮询时机和停车惯性无关
+ */
+static void lift_homing_action(void) {
+    float current = lift_encoder.get_position(&lift_encoder);
+    bool pressed = lift_home_switch.is_pressed(&lift_home_switch);
+
+    if(systick_get_ms() - _home_start_ms > HOME_TIMEOUT_MS) {
+        _lift_homed = false;
+        printf("$LIFT:HOME_FAIL#");
+        a_fsm_trigger_event(EVENT_LIFT_STOP);
+        return;
+    }
+
+    switch(_home_phase) {
+        case HomePreBackoff:
+            a_board_lift_drive(1.0f);
+            if(!pressed && current - _home_phase_start_mm >= HOME_BACKOFF_MM) {
+                home_enter_phase(HomeSeek);
+            }
+            break;
+
+        case HomeApproach:
+            a_board_lift_drive(-1.0f);
+            if(current <= HOME_APPROACH_MM) {
+                home_enter_phase(HomeSeek);
+            }
+            break;
+
+        case HomeSeek: {
+            a_board_lift_drive(-1.0f);
+
+            int64_t latch;
+            if(lift_home_switch.take_latch(&lift_home_switch, &latch)) {
+                a_board_lift_stop();
+                lift_encoder.set_origin(&lift_encoder, latch);
+                // 旧坐标系下的零点位置即为重新回零的漂移量
+                _home_drift_mm = current - lift_encoder.get_position(&lift_encoder);
+                home_enter_phase(HomeBackoff);
+            }
+            else if(_home_fast && current < -HOME_FAST_WINDOW_MM) {
+                _lift_homed = false;
+                printf("$LIFT:HOME_FAIL#");
+                a_fsm_trigger_event(EVENT_LIFT_STOP);
+            }
+            break;
+        }
+
+        case HomeBackoff:
+            a_board_lift_drive(1.0f);
+            if(!pressed && current >= HOME_BACKOFF_MM) {
+                a_board_lift_stop();
+                if(_home_fast && _lift_homed) {
+                    printf("$LIFT:HOMED,%.2f#", _home_drift_mm);
+                }
+                else {
+                    printf("$LIFT:HOMED#");
+                }
+                _lift_homed = true;
+                a_fsm_trigger_event(EVENT_LIFT_STOP);
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief   切换回零阶段
+ * @param   phase 新阶段
+ */
+static void home_enter_phase(HomePhase_e phase) {
+    _home_phase = phase;
+    _home_phase_start_mm = lift_encoder.get_position(&lift_encoder);
+    if(phase == HomeSeek) {
+        lift_home_switch.arm(&lift_home_switch);
+    }
+}
+
+/**
+ * @brief   当前驱动是否应使平台运动 (运动监视据此判断堵转)
+ * @retval  bool true:应运动
+ * @note    定位轨迹结束后 PID 只修正剩余误差, 前馈辨识的起步段占空比从 0 缓慢增大,
+ *          这两种情况下驱动不为 0 而平台静止属于正常
+ */
+static bool lift_driven(void) {
+#if LIFT_POS_CTRL_PID
+    if(cur_state == &state_lift_moving) return !s_lift_profile_done();
+#endif
+    if(cur_state == &state_lift_ff_ident) return false;
+    return true;
+}
+
+/**
+ * @brief   定位开始计时
+ * @param   pos 当前位置
+ * @note    允许时间按剩余行程计算; 运动中改目标 (新命令或航点衔接) 时从改目标处重新计时
+ */
+static void move_timer_start(float pos) {
+    _move_target_mm = lift_target_pos_mm;
+    _move_start_ms = systick_get_ms();
+    _move_limit_ms = MOVE_TIMEOUT_BASE_MS + (uint32_t)(fabsf(lift_target_pos_mm - pos) * 1000.0f / MOVE_TIMEOUT_MIN_MM_S);
+}
+
 /**
  * @brief   错误状态事件处理函数
  * @param   e 事件
@@ -352,7 +1316,165 @@ static State* error_handle_event(event_e e) {
  * @brief   错误状态进入动作函数
  */
 static void error_entry(void) {
-    lift_relay.stop(&lift_relay);
+    a_board_lift_stop();
     gripper.open(&gripper);
-    a_fsm_trigger_event(EVENT_OK);
+    s_wireless_comms_lock_motion(true);
+    queue_abort();
+
+    // 运动故障 (如编码器断线) 后位置不可信, 需重新回零
+    if(s_lift_monitor_fault() != LiftFaultNone) {
+        _lift_homed = false;
+    }
+    printf("$ERROR#");
+}
+
+/**
+ * @brief   错误状态退出动作函数
+ */
+static void error_exit(void) {
+    s_wireless_comms_lock_motion(false);
+    lift_target_pos_mm = lift_encoder.get_position(&lift_encoder);
+}
+
+/**
+ * @brief   错误状态持续动作函数
+ * @note    错误状态保持锁存, 只有 $FAULT_CLEAR# 才能回到空闲状态; 其余升降台请求被丢弃
+ */
+static void error_action(void) {
+    s_wireless_comms_process();
+
+    if(lift_req.req == LiftReqFaultClear) {
+        s_lift_monitor_reset();
+        a_fsm_trigger_event(EVENT_OK);
+    }
+    else if(lift_req.req == LiftReqPidBench) {
+        s_pid_bench_reject();
+    }
+    lift_req.req = LiftReqNone;
+    s_lift_latency_poll();
+
+    // 继续更新编码器, 保持位置连续
+    if(tick.flag) {
+        tick.flag = 0;
+        lift_encoder.update(&lift_encoder);
+        a_board_lift_update();
+    }
+}
+
+/**
+ * @brief   从航点队列开始下一段运动
+ * @param   pos 当前位置
+ * @note    目标取可连续衔接的最后一个航点; 已在到位死区内则直接视为到达
+ */
+static void queue_start(float pos) {
+    // 未建立零点时位置无意义, 丢弃队列
+    if(!_lift_homed) {
+        s_lift_queue_clear();
+        printf("$LIFT:NOT_HOMED#");
+        return;
+    }
+
+    lift_wp_t first, last;
+    uint8_t n = s_lift_queue_blend(pos);
+    s_lift_queue_peek(0, &first);
+    s_lift_queue_peek(n - 1, &last);
+
+    _wp_active = true;
+    _wp_run = n;
+    _wp_dir = (first.pos_mm >= pos) ? 1.0f : -1.0f;
+    lift_target_pos_mm = last.pos_mm;
+
+    if(fabsf(last.pos_mm - pos) <= LIFT_POS_BAND_MM) {
+        queue_arrive();
+    }
+}
+
+/**
+ * @brief   运动中跟踪航点队列
+ * @param   pos 当前位置
+ * @note    越过中途航点时出队并报告; 运动中追加的同向航点可继续衔接, 目标随之后移
+ */
+static void queue_track(float pos) {
+    // 队列被 $LIFT_SET / $LIFT_QUEUE_CLEAR 清空: 按当前目标继续, 不再属于队列
+    if(s_lift_queue_count() == 0) {
+        _wp_active = false;
+        return;
+    }
+
+    lift_wp_t wp;
+    while(_wp_run > 1 && s_lift_queue_peek(0, &wp) && (pos - wp.pos_mm) * _wp_dir >= 0.0f) {
+        s_lift_queue_pop(0);
+        _wp_run--;
+        printf("$LIFT:WP,%.2f,%u#", wp.pos_mm, (unsigned)s_lift_queue_count());
+    }
+
+    // 队首仍在前方时才允许向后衔接, 越过最后航点 (超调) 后不再延伸
+    if(!s_lift_queue_peek(0, &wp) || (wp.pos_mm - pos) * _wp_dir <= 0.0f) return;
+
+    uint8_t n = s_lift_queue_blend(pos);
+    if(n > _wp_run && s_lift_queue_peek(n - 1, &wp)) {
+        _wp_run = n;
+        lift_target_pos_mm = wp.pos_mm;
+    }
+}
+
+/**
+ * @brief   本段运动结束: 剩余衔接航点出队, 开始停留计时
+ * @param   None
+ * @retval  None
+ */
+static void queue_arrive(void) {
+    if(!_wp_active) return;
+    _wp_active = false;
+
+    lift_wp_t wp = { 0.0f, 0 };
+    while(_wp_run > 0 && s_lift_queue_pop(&wp)) {
+        _wp_run--;
+        printf("$LIFT:WP,%.2f,%u#", wp.pos_mm, (unsigned)s_lift_queue_count());
+    }
+    _wp_run = 0;
+
+    _wp_dwell_ms = wp.dwell_ms;
+    _wp_dwell_start_ms = systick_get_ms();
+
+    if(s_lift_queue_count() == 0) {
+        printf("$LIFT:QUEUE_DONE,%lu#", (unsigned long)s_lift_queue_reached());
+    }
+}
+
+/**
+ * @brief   放弃航点队列 (回零, 标定, 错误)
+ * @param   None
+ * @retval  None
+ */
+static void queue_abort(void) {
+    s_lift_queue_clear();
+    _wp_active = false;
+    _wp_run = 0;
+    _wp_dwell_ms = 0;
+}
+
+/**
+ * @brief   参数写入 Flash: 空闲状态下立即写入, 否则推迟到回到空闲状态
+ * @param   None
+ * @retval  None
+ * @note    擦除整页期间 CPU 停顿数十毫秒 (代码在 Flash 中执行), 驱动保持原状态且不检查软限位,
+ *          因此运动中 (定位 / 点动等) 不写入
+ */
+static void param_save_deferred(void) {
+    _param_dirty = true;
+    if(cur_state == &state_idle) param_flush();
+}
+
+/**
+ * @brief   写入推迟的参数 (空闲状态每轮调用)
+ * @param   None
+ * @retval  None
+ */
+static void param_flush(void) {
+    if(!_param_dirty) return;
+    _param_dirty = false;
+    if(!s_param_save()) {
+        s_log_error("param save failed");
+    }
 }
@@ -8,7 +8,13 @@
  * ├──  NormalState (state_normal)
  * |    |
  * |    ├── IdleState (state_idle)
- * |    └── LiftMovingState (state_lift_moving)
+ * |    ├── LiftMovingState (state_lift_moving)
+ * |    ├── LiftJogState (state_lift_jog)
+ * |    ├── LiftCalibState (state_lift_calib)
+ * |    ├── LiftAutotuneState (state_lift_autotune)
+ * |    ├── LiftIdentState (state_lift_ident)
+ * |    ├── LiftFfIdentState (state_lift_ff_ident)
+ * |    └── LiftHomingState (state_lift_homing)
  * |
  * └──  ErrorState (state_error)
  */
@@ -30,6 +36,12 @@ typedef enum {
     EVENT_ERROR,
     EVENT_LIFT_MOVE,
     EVENT_LIFT_STOP,
+    EVENT_LIFT_CALIB,
+    EVENT_LIFT_HOME,
+    EVENT_LIFT_JOG,
+    EVENT_LIFT_AUTOTUNE,
+    EVENT_LIFT_IDENT,
+    EVENT_LIFT_FF_IDENT,
     EVENT_MAX
 } event_e;
 
@@ -73,10 +85,13 @@ extern State* cur_state;
  *  - 正常状态
  *      - 空闲状态
  *      - 升降台移动状态
+ *      - 升降台编码器标定状态
+ *      - 升降台回零状态
  *  - 错误状态
  */
 extern State state_normal;
-extern State state_idle, state_lift_moving;
+extern State state_idle, state_lift_moving, state_lift_jog, state_lift_calib, state_lift_autotune, state_lift_ident,
+    state_lift_ff_ident, state_lift_homing;
 extern State state_error;
 
 // ! ========================= 接 口 函 数 声 明 ========================= ! //
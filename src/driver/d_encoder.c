@@ -5,17 +5,42 @@
 #include "d_encoder.h"
 #include "timer.h"
 
-// ! ========================= 变 量 声 明 ========================= ! //
+#include <math.h>
 
+// ! ========================= 变 量 声 明 ========================= ! //
 
+// 16 位计数器模值
+#define ENCODER_CNT_MOD         65536
+// 半量程: 判断溢出方向用
+#define ENCODER_CNT_HALF        0x8000u
+// Q16 定点 -> 整数 (四舍五入)
+#define ENCODER_Q16_ROUND(x)    ((int32_t)(((x) + 0x8000) >> 16))
+// Q16 定点乘法 (四舍五入, 结果为 int64)
+#define ENCODER_Q16_MUL(a, b)   (((int64_t)(a) * (b) + 0x8000) >> 16)
+// 观测器带宽上限 (相对更新频率)
+#define ENCODER_OBS_BW_MAX      0.25f
+// 每毫米脉冲数下限: 标定系数 (um/脉冲, Q16) 不超出 int32
+#define ENCODER_PPM_MIN         0.05f
 
 // ! ========================= 私 有 函 数 声 明 ========================= ! //
 
-static int _read_raw(const tim_cfg_t* cfg);
-static void _init(Encoder* self, const tim_cfg_t* cfg, int period_ms, int32_t pulses_per_mm);
+static int64_t _read_count(Encoder* self);
+static void _on_wrap(void* arg);
+static void _init(Encoder* self, const tim_cfg_t* cfg, int period_ms, float pulses_per_mm);
+static void _observe(Encoder* self, int64_t pos_q16);
 static void _update(Encoder* self);
 static float _get_position(const Encoder* self);
 static float _get_speed(const Encoder* self);
+static int32_t _get_position_um(const Encoder* self);
+static int32_t _get_speed_um_s(const Encoder* self);
+static float _get_accel(const Encoder* self);
+static int32_t _get_accel_um_s2(const Encoder* self);
+static void _set_speed_mode(Encoder* self, EncoderSpeedMode_e mode, float bandwidth_hz);
+static void _set_scale(Encoder* self, float ppm_up, float ppm_down);
+static void _set_origin(Encoder* self, int64_t pulses);
+static int32_t _ppm_to_q16(float ppm);
+static int64_t _count_to_q16(const Encoder* self, int64_t count);
+static int64_t _get_pulses(Encoder* self);
 
 // ! ========================= 接 口 函 数 实 现 ========================= ! //
 
@@ -26,62 +51,156 @@ static float _get_speed(const Encoder* self);
  */
 Encoder encoder_create(void) {
     Encoder obj;
+    obj._wraps_ = 0;
     obj._total_pulses_ = 0;
-    obj._pulses_per_mm_ = 0;
-    obj._position_mm_ = 0;
-    obj._speed_ = 0;
+    obj._origin_pulses_ = 0;
+    obj._um_per_pulse_up_q16_ = 0;
+    obj._um_per_pulse_down_q16_ = 0;
+    obj._rate_q16_ = 0;
+    obj._pos_q16_ = 0;
+    obj._position_um_ = 0;
+    obj._speed_um_s_ = 0;
+    obj._accel_um_s2_ = 0;
+    obj._speed_mode_ = EncoderSpeedDiff;
+    obj._obs_alpha_q16_ = 0;
+    obj._obs_beta_q16_ = 0;
+    obj._obs_gamma2_q16_ = 0;
+    obj._obs_pos_q16_ = 0;
+    obj._obs_vel_q16_ = 0;
+    obj._obs_acc_q16_ = 0;
     obj.init = _init;
     obj.update = _update;
     obj.get_position = _get_position;
     obj.get_speed = _get_speed;
+    obj.get_position_um = _get_position_um;
+    obj.get_speed_um_s = _get_speed_um_s;
+    obj.get_accel = _get_accel;
+    obj.get_accel_um_s2 = _get_accel_um_s2;
+    obj.set_speed_mode = _set_speed_mode;
+    obj.set_scale = _set_scale;
+    obj.set_origin = _set_origin;
+    obj.get_pulses = _get_pulses;
     return obj;
 }
 
 // ! ========================= 私 有 函 数 实 现 ========================= ! //
 
 /**
- * @brief   读取原始计数值
- * @param   None
- * @retval  int 计数值
+ * @brief   读取 64 位累计计数值
+ * @param   self 编码器对象
+ * @retval  int64_t 计数值
+ * @note    关中断读取圈数与计数器; 若溢出已发生而中断尚未执行 (UIF 挂起),
+ *          在此按计数值所在半区补偿一圈, 中断随后照常记账
+ */
+static int64_t _read_count(Encoder* self) {
+    TIM_TypeDef* tim = self->_tim_.cfg->periph;
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    int32_t wraps = self->_wraps_;
+    uint16_t cnt = TIM_GetCounter(tim);
+    if(TIM_GetFlagStatus(tim, TIM_FLAG_Update) == SET) {
+        cnt = TIM_GetCounter(tim);
+        wraps += (cnt < ENCODER_CNT_HALF) ? 1 : -1;
+    }
+
+    __set_PRIMASK(primask);
+    return (int64_t)wraps * ENCODER_CNT_MOD + cnt;
+}
+
+/**
+ * @brief   计数器溢出中断回调
+ * @param   arg 编码器对象
+ * @retval  None
+ * @note    上溢后计数值从 0 附近继续, 下溢后从 65535 附近继续, 据此判断方向;
+ *          只要中断延迟内走过的脉冲数小于半量程即不会误判
  */
-static int _read_raw(const tim_cfg_t* cfg) {
-    int cnt = (int)TIM_GetCounter(cfg->periph);
-    TIM_SetCounter(cfg->periph, 0);
-    return cnt;
+static void _on_wrap(void* arg) {
+    Encoder* self = (Encoder*)arg;
+    uint16_t cnt = TIM_GetCounter(self->_tim_.cfg->periph);
+    self->_wraps_ += (cnt < ENCODER_CNT_HALF) ? 1 : -1;
 }
 
 /**
  * @brief   初始化编码器
  * @param   self 编码器对象
  * @retval  None
+ * @note    浮点标定值只在此处换算一次, 周期更新全部为整数运算
  */
-static void _init(Encoder* self, const tim_cfg_t* cfg, int period_ms, int32_t pulses_per_mm) {
+static void _init(Encoder* self, const tim_cfg_t* cfg, int period_ms, float pulses_per_mm) {
+    if(period_ms <= 0) period_ms = 1;
 
+    self->_wraps_ = 0;
     self->_total_pulses_ = 0;
-    self->_position_mm_ = 0;
-    self->_speed_ = 0;
-    self->_pulses_per_mm_ = pulses_per_mm;
-    self->_tim_cfg_ = *cfg;
+    self->_origin_pulses_ = 0;
+    self->_pos_q16_ = 0;
+    self->_position_um_ = 0;
+    self->_speed_um_s_ = 0;
+    self->_accel_um_s2_ = 0;
+    self->_obs_pos_q16_ = 0;
+    self->_obs_vel_q16_ = 0;
+    self->_obs_acc_q16_ = 0;
     self->_period_ms_ = period_ms;
+    // 64 位计算; 速度 = 位置增量 (Q16) × 更新频率 (Q16) 也在 64 位中完成, period_ms = 1 时不溢出
+    self->_rate_q16_ = (int32_t)(((int64_t)1000 << 16) / period_ms);
+    self->_um_per_pulse_up_q16_ = _ppm_to_q16(pulses_per_mm);
+    self->_um_per_pulse_down_q16_ = self->_um_per_pulse_up_q16_;
 
-    tim_init(0, cfg);
+    tim_init(&self->_tim_, cfg);
+    tim_set_callback(&self->_tim_, _on_wrap, self);
 }
 
 /**
  * @brief   更新编码器数据
  * @param   self 编码器对象
  * @retval  None
+ * @note    计数器自由运行, 位置每次由 64 位累计计数值直接换算, 不会丢失读写之间的边沿;
+ *          位置只取决于计数值, 静止时的 ±1 脉冲抖动不会累积漂移
  */
 static void _update(Encoder* self) {
-    int raw = _read_raw(&self->_tim_cfg_);
+    int64_t count = _read_count(self);
+    int64_t pos_q16 = _count_to_q16(self, count);
+    int64_t dpos_q16 = pos_q16 - self->_pos_q16_;
+    self->_total_pulses_ = count;
+
+    self->_pos_q16_ = pos_q16;
+    self->_position_um_ = ENCODER_Q16_ROUND(self->_pos_q16_);
+
+    if(self->_speed_mode_ == EncoderSpeedObserver) {
+        _observe(self, self->_pos_q16_);
+    }
+    else {
+        int32_t speed = ENCODER_Q16_ROUND(ENCODER_Q16_MUL(dpos_q16, self->_rate_q16_));
+        self->_accel_um_s2_ = ENCODER_Q16_ROUND((int64_t)(speed - self->_speed_um_s_) * self->_rate_q16_);
+        self->_speed_um_s_ = speed;
+    }
+}
+
+/**
+ * @brief   α-β-γ 跟踪观测器单步
+ * @param   self 编码器对象
+ * @param   pos_q16 本周期位置测量 (um, Q16)
+ * @retval  None
+ * @note    以更新周期为时间单位: 预测 x += v + a/2, v += a; 再按残差校正.
+ *          脉冲量化误差被观测器平均, 低速时速度不再只有几个离散档位
+ */
+static void _observe(Encoder* self, int64_t pos_q16) {
+    int64_t acc = self->_obs_acc_q16_;
+    int64_t vel = self->_obs_vel_q16_ + acc;
+    int64_t pos = self->_obs_pos_q16_ + self->_obs_vel_q16_ + (acc >> 1);
+
+    int64_t r = pos_q16 - pos;
+    pos += ENCODER_Q16_MUL(r, self->_obs_alpha_q16_);
+    vel += ENCODER_Q16_MUL(r, self->_obs_beta_q16_);
+    acc += ENCODER_Q16_MUL(r, self->_obs_gamma2_q16_);
 
-    if(raw < 32767)
-        self->_total_pulses_ += raw;
-    else
-        self->_total_pulses_ -= (65536 - raw);
+    self->_obs_pos_q16_ = pos;
+    self->_obs_vel_q16_ = vel;
+    self->_obs_acc_q16_ = acc;
 
-    self->_position_mm_ = (float)self->_total_pulses_ / self->_pulses_per_mm_ + 0.5f;
-    self->_speed_ = (float)raw / self->_pulses_per_mm_ / (self->_period_ms_ / 1000.0f);
+    // 周期单位 -> 秒单位: 速度乘一次更新频率, 加速度乘两次
+    self->_speed_um_s_ = ENCODER_Q16_ROUND(ENCODER_Q16_MUL(vel, self->_rate_q16_));
+    self->_accel_um_s2_ = ENCODER_Q16_ROUND(ENCODER_Q16_MUL(ENCODER_Q16_MUL(acc, self->_rate_q16_), self->_rate_q16_));
 }
 
 /**
@@ -90,7 +209,7 @@ static void _update(Encoder* self) {
  * @retval  float 位置(mm)
  */
 static float _get_position(const Encoder* self) {
-    return self->_position_mm_;
+    return self->_position_um_ * 0.001f;
 }
 
 /**
@@ -99,5 +218,140 @@ static float _get_position(const Encoder* self) {
  * @retval  float 速度(mm/s)
  */
 static float _get_speed(const Encoder* self) {
-    return self->_speed_;
+    return self->_speed_um_s_ * 0.001f;
+}
+
+/**
+ * @brief   获取位置
+ * @param   self 编码器对象
+ * @retval  int32_t 位置(um)
+ */
+static int32_t _get_position_um(const Encoder* self) {
+    return self->_position_um_;
+}
+
+/**
+ * @brief   获取速度
+ * @param   self 编码器对象
+ * @retval  int32_t 速度(um/s)
+ */
+static int32_t _get_speed_um_s(const Encoder* self) {
+    return self->_speed_um_s_;
+}
+
+/**
+ * @brief   获取加速度
+ * @param   self 编码器对象
+ * @retval  float 加速度(mm/s^2)
+ */
+static float _get_accel(const Encoder* self) {
+    return self->_accel_um_s2_ * 0.001f;
+}
+
+/**
+ * @brief   获取加速度
+ * @param   self 编码器对象
+ * @retval  int32_t 加速度(um/s^2)
+ */
+static int32_t _get_accel_um_s2(const Encoder* self) {
+    return self->_accel_um_s2_;
+}
+
+/**
+ * @brief   选择速度估计方式
+ * @param   self 编码器对象
+ * @param   mode 估计方式
+ * @param   bandwidth_hz 观测器带宽(Hz)
+ * @retval  None
+ * @note    需在 init 之后调用. 观测器三个极点均置于 p = exp(-2π·bw·T):
+ *          α = 1 - p^3, β = 1.5(1-p)^2(1+p), 2γ = (1-p)^3;
+ *          切换时以当前位置/速度初始化状态, 输出无跳变
+ */
+static void _set_speed_mode(Encoder* self, EncoderSpeedMode_e mode, float bandwidth_hz) {
+    if(mode == EncoderSpeedObserver) {
+        float rate_hz = 1000.0f / self->_period_ms_;
+        if(bandwidth_hz <= 0.0f || bandwidth_hz > rate_hz * ENCODER_OBS_BW_MAX) {
+            bandwidth_hz = rate_hz * ENCODER_OBS_BW_MAX;
+        }
+
+        float p = expf(-2.0f * 3.14159265f * bandwidth_hz / rate_hz);
+        float q = 1.0f - p;
+        self->_obs_alpha_q16_ = (int32_t)((1.0f - p * p * p) * 65536.0f + 0.5f);
+        self->_obs_beta_q16_ = (int32_t)(1.5f * q * q * (1.0f + p) * 65536.0f + 0.5f);
+        self->_obs_gamma2_q16_ = (int32_t)(q * q * q * 65536.0f + 0.5f);
+
+        self->_obs_pos_q16_ = self->_pos_q16_;
+        self->_obs_vel_q16_ = (int64_t)self->_speed_um_s_ * 65536 * self->_period_ms_ / 1000;
+        self->_obs_acc_q16_ = 0;
+    }
+
+    self->_speed_mode_ = mode;
+}
+
+/**
+ * @brief   获取当前累计脉冲数
+ * @param   self 编码器对象
+ * @retval  int64_t 累计脉冲数
+ */
+static int64_t _get_pulses(Encoder* self) {
+    return _read_count(self);
+}
+
+/**
+ * @brief   设置标定系数
+ * @param   self 编码器对象
+ * @param   ppm_up 上行每毫米脉冲数
+ * @param   ppm_down 下行每毫米脉冲数
+ * @retval  None
+ * @note    当前位置按新系数由零点重新换算, 观测器位置同步平移
+ */
+static void _set_scale(Encoder* self, float ppm_up, float ppm_down) {
+    self->_um_per_pulse_up_q16_ = _ppm_to_q16(ppm_up);
+    self->_um_per_pulse_down_q16_ = _ppm_to_q16(ppm_down);
+
+    int64_t pos_q16 = _count_to_q16(self, self->_total_pulses_);
+    self->_obs_pos_q16_ += pos_q16 - self->_pos_q16_;
+    self->_pos_q16_ = pos_q16;
+    self->_position_um_ = ENCODER_Q16_ROUND(pos_q16);
+}
+
+/**
+ * @brief   设置零点
+ * @param   self 编码器对象
+ * @param   pulses 零点处的累计脉冲数
+ * @retval  None
+ * @note    以上一次 update 的计数为基准换算, 观测器位置同步平移, 速度估计不受影响
+ */
+static void _set_origin(Encoder* self, int64_t pulses) {
+    self->_origin_pulses_ = pulses;
+    int64_t pos_q16 = _count_to_q16(self, self->_total_pulses_);
+
+    self->_obs_pos_q16_ += pos_q16 - self->_pos_q16_;
+    self->_pos_q16_ = pos_q16;
+    self->_position_um_ = ENCODER_Q16_ROUND(pos_q16);
+}
+
+/**
+ * @brief   每毫米脉冲数 -> Q16 标定系数 (um/脉冲)
+ * @param   ppm 每毫米脉冲数
+ * @retval  int32_t 标定系数
+ * @note    无效值按 1 处理, 过小的值按 ENCODER_PPM_MIN 处理
+ */
+static int32_t _ppm_to_q16(float ppm) {
+    if(ppm <= 0.0f) ppm = 1.0f;
+    if(ppm < ENCODER_PPM_MIN) ppm = ENCODER_PPM_MIN;
+    return (int32_t)(1000.0f / ppm * 65536.0f + 0.5f);
+}
+
+/**
+ * @brief   累计脉冲数 -> 位置 (um, Q16)
+ * @param   self 编码器对象
+ * @param   count 累计脉冲数
+ * @retval  int64_t 位置
+ * @note    位置 = (计数 - 零点) × 标定系数, 系数按相对零点的净行程方向选取 (零点上方用上行系数);
+ *          两个系数在零点处都为 0, 位置连续, 同一计数总是对应同一位置
+ */
+static int64_t _count_to_q16(const Encoder* self, int64_t count) {
+    int64_t diff = count - self->_origin_pulses_;
+    return diff * (diff >= 0 ? self->_um_per_pulse_up_q16_ : self->_um_per_pulse_down_q16_);
 }
@@ -1,6 +1,11 @@
 /**
  * @file    d_encoder.h
  * @brief   编码器驱动
+ * @note    定时器计数器自由运行, 不再读后清零;
+ *          16 位计数值由更新中断记录的溢出圈数扩展为 64 位累计脉冲;
+ *          位置/速度以整数微米 (um, um/s) 计算, 标定系数为 Q16 定点 (um/脉冲),
+ *          上行/下行可分别标定, 位置 = (计数 - 零点) × 按净行程方向选取的系数; 仅在 get_position / get_speed 处转换为 float;
+ *          速度估计可选: 周期差分 (默认) 或 α-β-γ 跟踪观测器 (低速时速度/加速度平滑连续)
  */
 #ifndef _d_encoder_h_
 #define _d_encoder_h_
@@ -11,15 +16,23 @@
 
 // ! ========================= 接 口 变 量 / Typedef 声 明 ========================= ! //
 
+typedef enum {
+    EncoderSpeedDiff = 0,           // 周期脉冲差分
+    EncoderSpeedObserver            // α-β-γ 跟踪观测器 (三重极点, 临界阻尼)
+} EncoderSpeedMode_e;
+
 typedef struct Encoder Encoder;
 struct Encoder {
 // public:
     /**
      * @brief   初始化编码器
      * @param   self 编码器对象
+     * @param   cfg 定时器配置 (需 TIM_MODE_ENCODER 且 enable_irq = 1)
+     * @param   period_ms 更新周期(ms)
+     * @param   pulses_per_mm 每毫米脉冲数 (仅初始化时换算为 Q16 标定系数)
      * @retval  None
      */
-    void(*init)(Encoder* self, const tim_cfg_t* cfg, int period_ms, int32_t pulses_per_mm);
+    void(*init)(Encoder* self, const tim_cfg_t* cfg, int period_ms, float pulses_per_mm);
     /**
      * @brief   更新编码器数据
      * @param   self 编码器对象
@@ -29,24 +42,91 @@ struct Encoder {
     /**
      * @brief   获取位置
      * @param   self 编码器对象
-     * @retval  int32_t 位置(mm)
+     * @retval  float 位置(mm)
      */
     float(*get_position)(const Encoder* self);
     /**
      * @brief   获取速度
      * @param   self 编码器对象
-     * @retval  int32_t 速度(mm/s)
+     * @retval  float 速度(mm/s)
      */
     float(*get_speed)(const Encoder* self);
+    /**
+     * @brief   获取位置
+     * @param   self 编码器对象
+     * @retval  int32_t 位置(um)
+     */
+    int32_t(*get_position_um)(const Encoder* self);
+    /**
+     * @brief   获取速度
+     * @param   self 编码器对象
+     * @retval  int32_t 速度(um/s)
+     */
+    int32_t(*get_speed_um_s)(const Encoder* self);
+    /**
+     * @brief   获取加速度
+     * @param   self 编码器对象
+     * @retval  float 加速度(mm/s^2)
+     */
+    float(*get_accel)(const Encoder* self);
+    /**
+     * @brief   获取加速度
+     * @param   self 编码器对象
+     * @retval  int32_t 加速度(um/s^2)
+     */
+    int32_t(*get_accel_um_s2)(const Encoder* self);
+    /**
+     * @brief   选择速度估计方式
+     * @param   self 编码器对象
+     * @param   mode 估计方式
+     * @param   bandwidth_hz 观测器带宽(Hz), 仅 EncoderSpeedObserver 使用, 需小于更新频率的 1/4
+     * @retval  None
+     */
+    void(*set_speed_mode)(Encoder* self, EncoderSpeedMode_e mode, float bandwidth_hz);
+    /**
+     * @brief   设置标定系数 (当前位置按新系数由零点重新换算)
+     * @param   self 编码器对象
+     * @param   ppm_up 上行 (计数增加方向) 每毫米脉冲数
+     * @param   ppm_down 下行每毫米脉冲数
+     * @retval  None
+     */
+    void(*set_scale)(Encoder* self, float ppm_up, float ppm_down);
+    /**
+     * @brief   设置零点: 令累计脉冲数为 pulses 处的位置为 0
+     * @param   self 编码器对象
+     * @param   pulses 零点处的累计脉冲数 (如限位开关中断中锁存的值)
+     * @retval  None
+     */
+    void(*set_origin)(Encoder* self, int64_t pulses);
+    /**
+     * @brief   获取当前累计脉冲数 (直接读取硬件, 可在中断中调用)
+     * @param   self 编码器对象
+     * @retval  int64_t 累计脉冲数
+     */
+    int64_t(*get_pulses)(Encoder* self);
 
 // private:
-    tim_cfg_t _tim_cfg_;
+    tim_t _tim_;
     int _period_ms_;
 
-    int32_t _total_pulses_;
-    int32_t _pulses_per_mm_;
-    float _position_mm_;
-    float _speed_;
+    volatile int32_t _wraps_;       // 计数器溢出圈数 (上溢 +1, 下溢 -1), 由更新中断维护
+    int64_t _total_pulses_;         // 上一次 update 时的累计脉冲数
+    int64_t _origin_pulses_;        // 零点处的累计脉冲数
+    int32_t _um_per_pulse_up_q16_;  // 上行标定系数 (um/脉冲, Q16)
+    int32_t _um_per_pulse_down_q16_;// 下行标定系数 (um/脉冲, Q16)
+    int32_t _rate_q16_;             // 更新频率 (Hz, Q16)
+    int64_t _pos_q16_;              // 位置 (um, Q16)
+    int32_t _position_um_;
+    int32_t _speed_um_s_;
+    int32_t _accel_um_s2_;
+
+    EncoderSpeedMode_e _speed_mode_;
+    int32_t _obs_alpha_q16_;        // 观测器增益 (Q16)
+    int32_t _obs_beta_q16_;
+    int32_t _obs_gamma2_q16_;       // 2γ
+    int64_t _obs_pos_q16_;          // 位置估计 (um, Q16)
+    int64_t _obs_vel_q16_;          // 速度估计 (um/周期, Q16)
+    int64_t _obs_acc_q16_;          // 加速度估计 (um/周期^2, Q16)
 };
 
 // ! ========================= 接 口 函 数 声 明 ========================= ! //
@@ -0,0 +1,104 @@
+/**
+ * @file    d_limit_switch.c
+ * @brief   限位开关驱动实现
+ */
+#include "d_limit_switch.h"
+
+// ! ========================= 变 量 声 明 ========================= ! //
+
+
+
+// ! ========================= 私 有 函 数 声 明 ========================= ! //
+
+static void _on_edge(void* arg);
+static void _init(LimitSwitch* self, const exti_cfg_t* cfg, uint8_t active_low, Encoder* encoder);
+static bool _is_pressed(const LimitSwitch* self);
+static void _arm(LimitSwitch* self);
+static bool _take_latch(LimitSwitch* self, int64_t* pulses);
+
+// ! ========================= 接 口 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   创建 LimitSwitch 对象
+ * @param   None
+ * @retval  LimitSwitch 对象
+ */
+LimitSwitch limit_switch_create(void) {
+    LimitSwitch obj;
+    obj._active_low_ = 1;
+    obj._encoder_ = 0;
+    obj._armed_ = 0;
+    obj._latched_ = 0;
+    obj._latch_pulses_ = 0;
+    obj.init = _init;
+    obj.is_pressed = _is_pressed;
+    obj.arm = _arm;
+    obj.take_latch = _take_latch;
+    return obj;
+}
+
+// ! ========================= 私 有 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   开关触发沿中断回调
+ * @param   arg 限位开关对象
+ * @retval  None
+ */
+static void _on_edge(void* arg) {
+    LimitSwitch* self = (LimitSwitch*)arg;
+    if(!self->_armed_) return;
+
+    self->_latch_pulses_ = self->_encoder_->get_pulses(self->_encoder_);
+    self->_armed_ = 0;
+    self->_latched_ = 1;
+}
+
+/**
+ * @brief   初始化限位开关
+ * @param   self 限位开关对象
+ * @retval  None
+ */
+static void _init(LimitSwitch* self, const exti_cfg_t* cfg, uint8_t active_low, Encoder* encoder) {
+    self->_active_low_ = active_low;
+    self->_encoder_ = encoder;
+    self->_armed_ = 0;
+    self->_latched_ = 0;
+    self->_latch_pulses_ = 0;
+
+    exti_init(&self->_exti_, cfg);
+    exti_set_callback(&self->_exti_, _on_edge, self);
+}
+
+/**
+ * @brief   是否处于按下状态
+ * @param   self 限位开关对象
+ * @retval  bool true:按下
+ */
+static bool _is_pressed(const LimitSwitch* self) {
+    bool high = exti_read_pin(&self->_exti_);
+    return self->_active_low_ ? !high : high;
+}
+
+/**
+ * @brief   清除锁存, 准备锁存下一次触发
+ * @param   self 限位开关对象
+ * @retval  None
+ */
+static void _arm(LimitSwitch* self) {
+    self->_latched_ = 0;
+    self->_armed_ = 1;
+}
+
+/**
+ * @brief   取出锁存值
+ * @param   self 限位开关对象
+ * @param   pulses 输出
+ * @retval  bool true:已触发
+ * @note    中断在置位 _latched_ 前已写好锁存值, 且锁存后不再改写 (需重新 arm)
+ */
+static bool _take_latch(LimitSwitch* self, int64_t* pulses) {
+    if(!self->_latched_) return false;
+    *pulses = self->_latch_pulses_;
+    self->_latched_ = 0;
+    return true;
+}
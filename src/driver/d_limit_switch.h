@@ -0,0 +1,63 @@
+/**
+ * @file    d_limit_switch.h
+ * @brief   限位开关驱动
+ * @note    开关触发沿进入外部中断, 在中断中锁存编码器累计脉冲数作为精确零点;
+ *          每次 arm 之后只锁存第一个沿, 机械抖动产生的后续沿被忽略
+ */
+#ifndef _d_limit_switch_h_
+#define _d_limit_switch_h_
+
+#include "exti.h"
+#include "d_encoder.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// ! ========================= 接 口 变 量 / Typedef 声 明 ========================= ! //
+
+typedef struct LimitSwitch LimitSwitch;
+struct LimitSwitch {
+// public:
+    /**
+     * @brief   初始化限位开关
+     * @param   self 限位开关对象
+     * @param   cfg 外部中断配置 (触发沿应为开关按下沿)
+     * @param   active_low 1: 按下为低电平
+     * @param   encoder 触发时锁存的编码器
+     * @retval  None
+     */
+    void(*init)(LimitSwitch* self, const exti_cfg_t* cfg, uint8_t active_low, Encoder* encoder);
+    /**
+     * @brief   是否处于按下状态
+     * @param   self 限位开关对象
+     * @retval  bool true:按下
+     */
+    bool(*is_pressed)(const LimitSwitch* self);
+    /**
+     * @brief   清除锁存, 准备锁存下一次触发
+     * @param   self 限位开关对象
+     * @retval  None
+     */
+    void(*arm)(LimitSwitch* self);
+    /**
+     * @brief   取出锁存值
+     * @param   self 限位开关对象
+     * @param   pulses 输出: 触发时的编码器累计脉冲数
+     * @retval  bool true:已触发并输出锁存值, false:尚未触发
+     */
+    bool(*take_latch)(LimitSwitch* self, int64_t* pulses);
+
+// private:
+    exti_t _exti_;
+    uint8_t _active_low_;
+    Encoder* _encoder_;
+    volatile uint8_t _armed_;
+    volatile uint8_t _latched_;
+    int64_t _latch_pulses_;
+};
+
+// ! ========================= 接 口 函 数 声 明 ========================= ! //
+
+LimitSwitch limit_switch_create(void);
+
+#endif
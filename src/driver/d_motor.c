@@ -0,0 +1,168 @@
+/**
+ * @file    d_motor.c
+ * @brief   H 桥直流电机驱动实现
+ */
+#include "d_motor.h"
+
+// ! ========================= 变 量 声 明 ========================= ! //
+
+
+
+// ! ========================= 私 有 函 数 声 明 ========================= ! //
+
+static void _init(Motor* self, const motor_cfg_t* cfg);
+static void _set_duty(Motor* self, float duty);
+static void _stop(Motor* self);
+static void _update(Motor* self, float dt_s);
+static float _get_duty(const Motor* self);
+static void _set_leg_b(Motor* self, int8_t state);
+static void _output(Motor* self);
+
+// ! ========================= 接 口 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   创建 Motor 对象
+ * @param   None
+ * @retval  Motor 对象
+ */
+Motor motor_create(void) {
+    Motor obj;
+    obj.init = _init;
+    obj.set_duty = _set_duty;
+    obj.stop = _stop;
+    obj.update = _update;
+    obj.get_duty = _get_duty;
+    obj._cfg_ = 0;
+    obj._target_ = 0.0f;
+    obj._duty_ = 0.0f;
+    obj._leg_b_ = 0;
+    return obj;
+}
+
+// ! ========================= 私 有 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   初始化电机
+ * @param   self 电机对象
+ * @param   cfg 配置
+ * @retval  None
+ */
+static void _init(Motor* self, const motor_cfg_t* cfg) {
+    self->_cfg_ = cfg;
+
+    RCC_APB2PeriphClockCmd(cfg->b_rcc_mask, ENABLE);
+
+    GPIO_InitTypeDef gpio;
+    gpio.GPIO_Pin = cfg->b_high_pin | cfg->b_low_pin;
+    gpio.GPIO_Speed = GPIO_Speed_50MHz;
+    gpio.GPIO_Mode = GPIO_Mode_Out_PP;
+    GPIO_Init(cfg->b_port, &gpio);
+
+    /* 默认制动: 桥臂 B 下管导通, 桥臂 A 占空比 0 (下管导通) */
+    self->_leg_b_ = 0;
+    _set_leg_b(self, -1);
+
+    tim_init(&self->_tim_, cfg->tim);
+    _stop(self);
+}
+
+/**
+ * @brief   设置目标占空比
+ * @param   self 电机对象
+ * @param   duty 目标占空比 (-1 ~ 1)
+ * @retval  None
+ */
+static void _set_duty(Motor* self, float duty) {
+    if(duty > 1.0f) duty = 1.0f;
+    if(duty < -1.0f) duty = -1.0f;
+    self->_target_ = duty;
+}
+
+/**
+ * @brief   立即停止
+ * @param   self 电机对象
+ * @retval  None
+ * @note    正转时桥臂 B 已是下管, 桥臂 A 占空比 0 即两下管导通, 立即能耗制动;
+ *          反转时桥臂 B 上管导通, 这里只关断 (上下管不能在同一次写入中切换),
+ *          桥臂 B 悬空期间电机滑行, 下一次 update 切到下管后才开始制动
+ */
+static void _stop(Motor* self) {
+    self->_target_ = 0.0f;
+    self->_duty_ = 0.0f;
+    if(self->_leg_b_ > 0) _set_leg_b(self, 0);
+    _output(self);
+}
+
+/**
+ * @brief   斜坡处理并输出
+ * @param   self 电机对象
+ * @param   dt_s 周期 (s)
+ * @retval  None
+ */
+static void _update(Motor* self, float dt_s) {
+    float step = self->_cfg_->ramp_per_s * dt_s;
+    float target = self->_target_;
+    float duty = self->_duty_;
+
+    /* 目标方向所需的桥臂 B 状态; 目标为 0 时保持当前状态 */
+    int8_t want = -1;
+    if(target < 0.0f) want = 1;
+    else if(target == 0.0f && self->_leg_b_ != 0) want = self->_leg_b_;
+
+    /* 桥臂 B 未就绪时先回到 0 (换向必经 0) */
+    if(self->_leg_b_ != want) target = 0.0f;
+
+    if(target > duty + step) duty += step;
+    else if(target < duty - step) duty -= step;
+    else duty = target;
+    self->_duty_ = duty;
+
+    /* 桥臂 B 仅在占空比为 0 时切换, 中间经过一个周期的关断 */
+    if(duty == 0.0f && self->_leg_b_ != want) {
+        _set_leg_b(self, self->_leg_b_ == 0 ? want : 0);
+    }
+
+    _output(self);
+}
+
+/**
+ * @brief   获取当前实际输出的占空比
+ * @param   self 电机对象
+ * @retval  float 占空比 (-1 ~ 1)
+ */
+static float _get_duty(const Motor* self) {
+    return self->_duty_;
+}
+
+/**
+ * @brief   设置桥臂 B 状态 (先关断再导通)
+ * @param   self 电机对象
+ * @param   state 1 上管, -1 下管, 0 关断
+ * @retval  None
+ */
+static void _set_leg_b(Motor* self, int8_t state) {
+    const motor_cfg_t* cfg = self->_cfg_;
+
+    GPIO_ResetBits(cfg->b_port, cfg->b_high_pin | cfg->b_low_pin);
+    if(state > 0) GPIO_SetBits(cfg->b_port, cfg->b_high_pin);
+    else if(state < 0) GPIO_SetBits(cfg->b_port, cfg->b_low_pin);
+    self->_leg_b_ = state;
+}
+
+/**
+ * @brief   按当前占空比与桥臂 B 状态输出 PWM
+ * @param   self 电机对象
+ * @retval  None
+ * @note    桥臂 B 未就绪 (关断或方向不符) 时桥臂 A 保持下管导通
+ */
+static void _output(Motor* self) {
+    uint32_t full = (uint32_t)self->_cfg_->tim->period + 1u;
+    float duty = self->_duty_;
+    float a = 0.0f;
+
+    if(duty > 0.0f && self->_leg_b_ < 0) a = duty;
+    else if(duty < 0.0f && self->_leg_b_ > 0) a = 1.0f + duty;
+    else if(duty == 0.0f && self->_leg_b_ > 0) a = 1.0f;
+
+    tim_pwm_set_pulse(&self->_tim_, (uint16_t)(a * (float)full + 0.5f));
+}
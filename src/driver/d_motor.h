@@ -0,0 +1,84 @@
+/**
+ * @file    d_motor.h
+ * @brief   H 桥直流电机驱动 (符号-幅值 PWM)
+ * @note    桥臂 A 由 TIM1 一个通道的互补输出驱动 (硬件死区), 桥臂 B 由两个 GPIO 静态驱动:
+ *
+ *          方向    桥臂 B          桥臂 A 占空比        电机电压
+ *          正转    下管导通        d                    +d · V
+ *          反转    上管导通        1 - d                -d · V
+ *          停止    下管导通        0                    0 (两下管导通, 能耗制动)
+ *
+ *          反转中停止时桥臂 B 要经过一个周期的关断才能切到下管, 其间桥臂 B 悬空, 电机滑行一个周期
+ *
+ *          占空比按斜率限制逐周期变化, 换向必经 0; 桥臂 B 切换时先关断一个周期再导通,
+ *          上下管不会同时导通
+ */
+#ifndef _d_motor_h_
+#define _d_motor_h_
+
+#include "timer.h"
+
+#include <stdint.h>
+
+// ! ========================= 接 口 变 量 / Typedef 声 明 ========================= ! //
+
+typedef struct {
+    const tim_cfg_t* tim;           // 桥臂 A: TIM1 PWM 通道 (需配置互补输出与死区)
+    uint32_t b_rcc_mask;            // 桥臂 B GPIO 时钟 (APB2)
+    GPIO_TypeDef* b_port;
+    uint16_t b_high_pin;            // 桥臂 B 上管
+    uint16_t b_low_pin;             // 桥臂 B 下管
+    float ramp_per_s;               // 占空比变化率上限 (满量程 / s)
+} motor_cfg_t;
+
+typedef struct Motor Motor;
+struct Motor {
+// public:
+    /**
+     * @brief   初始化电机
+     * @param   self 电机对象
+     * @param   cfg 配置
+     * @retval  None
+     */
+    void (*init)(Motor* self, const motor_cfg_t* cfg);
+    /**
+     * @brief   设置目标占空比
+     * @param   self 电机对象
+     * @param   duty 目标占空比 (-1 ~ 1, 正为正转), 由 update 按斜率逼近
+     * @retval  None
+     */
+    void (*set_duty)(Motor* self, float duty);
+    /**
+     * @brief   立即停止 (不经斜坡): 正转时两下管导通, 能耗制动;
+     *          反转时桥臂 B 上管先关断, 电机滑行到下一次 update 切到下管后才开始制动
+     * @param   self 电机对象
+     * @retval  None
+     */
+    void (*stop)(Motor* self);
+    /**
+     * @brief   斜坡处理并输出 (每个控制周期调用一次)
+     * @param   self 电机对象
+     * @param   dt_s 周期 (s)
+     * @retval  None
+     */
+    void (*update)(Motor* self, float dt_s);
+    /**
+     * @brief   获取当前实际输出的占空比
+     * @param   self 电机对象
+     * @retval  float 占空比 (-1 ~ 1)
+     */
+    float (*get_duty)(const Motor* self);
+
+// private:
+    const motor_cfg_t* _cfg_;
+    tim_t _tim_;
+    float _target_;
+    float _duty_;
+    int8_t _leg_b_;                 // 桥臂 B: 1 上管, -1 下管, 0 关断
+};
+
+// ! ========================= 接 口 函 数 声 明 ========================= ! //
+
+Motor motor_create(void);
+
+#endif
@@ -6,13 +6,21 @@
 
 // ! ========================= 变 量 声 明 ========================= ! //
 
-
+// 计时上限, 超过后不再累加 (避免浮点精度丢失)
+#define RELAY_ELAPSED_MAX_S     1000.0f
+// 时间比较容差 (按周期累加的舍入误差)
+#define RELAY_TIME_EPS_S        1e-4f
 
 // ! ========================= 私 有 函 数 声 明 ========================= ! //
 
 static void _init(Relay* self, const relay_cfg_t* cfg);
 static void _set_dir(Relay* self, RelayDir_e dir);
 static void _stop(Relay* self);
+static void _update(Relay* self, float dt_s);
+static RelayDir_e _get_dir(const Relay* self);
+static void _get_stats(const Relay* self, relay_stats_t* out);
+static void _apply(Relay* self);
+static void _output(Relay* self, RelayDir_e dir);
 
 // ! ========================= 接 口 函 数 实 现 ========================= ! //
 
@@ -26,6 +34,17 @@ Relay relay_create(void) {
     obj.init = _init;
     obj.set_dir = _set_dir;
     obj.stop = _stop;
+    obj.update = _update;
+    obj.get_dir = _get_dir;
+    obj.get_stats = _get_stats;
+    obj._cfg_ = 0;
+    obj._dir_ = RelayDirStop;
+    obj._req_ = RelayDirStop;
+    obj._last_ = RelayDirStop;
+    obj._elapsed_s_ = RELAY_ELAPSED_MAX_S;
+    obj._stats_.actuations = 0;
+    obj._stats_.reversals = 0;
+    obj._stats_.deferred = 0;
     return obj;
 }
 
@@ -48,49 +67,128 @@ static void _init(Relay* self, const relay_cfg_t* cfg) {
             break;
     }
 
+    /* 先写输出寄存器再切换为输出, 避免上电瞬间误吸合 */
+    cfg->port->BRR = cfg->pin_a | cfg->pin_b;
+
     GPIO_InitTypeDef gpio;
     gpio.GPIO_Pin = cfg->pin_a | cfg->pin_b;
     gpio.GPIO_Speed = GPIO_Speed_50MHz;
     gpio.GPIO_Mode = GPIO_Mode_Out_PP;
     GPIO_Init(cfg->port, &gpio);
 
-    /* 默认停止 */
-    GPIO_ResetBits(cfg->port, cfg->pin_a);
-    GPIO_ResetBits(cfg->port, cfg->pin_b);
-
     self->_cfg_ = cfg;
+    self->_dir_ = RelayDirStop;
+    self->_req_ = RelayDirStop;
+    self->_last_ = RelayDirStop;
+    self->_elapsed_s_ = RELAY_ELAPSED_MAX_S;
 }
 
 /**
- * @brief   设置电机方向
+ * @brief   请求电机方向
  * @param   self 电机对象
  * @param   dir 方向
  * @retval  None
  */
 static void _set_dir(Relay* self, RelayDir_e dir) {
-    switch(dir) {
-        case RelayDirA:
-            GPIO_SetBits(self->_cfg_->port, self->_cfg_->pin_a);
-            GPIO_ResetBits(self->_cfg_->port, self->_cfg_->pin_b);
-            break;
-        case RelayDirB:
-            GPIO_ResetBits(self->_cfg_->port, self->_cfg_->pin_a);
-            GPIO_SetBits(self->_cfg_->port, self->_cfg_->pin_b);
-            break;
-        case RelayDirStop:
-        default:
-            GPIO_ResetBits(self->_cfg_->port, self->_cfg_->pin_a);
-            GPIO_ResetBits(self->_cfg_->port, self->_cfg_->pin_b);
-            break;
-    }
+    if(dir != RelayDirA && dir != RelayDirB) dir = RelayDirStop;
+    if(dir == self->_req_) return;
+
+    self->_req_ = dir;
+    _apply(self);
+    if(self->_dir_ != self->_req_) self->_stats_.deferred++;
 }
 
 /**
- * @brief   停止电机
+ * @brief   立即停止电机
  * @param   self 电机对象
  * @retval  None
  */
 static void _stop(Relay* self) {
-    GPIO_ResetBits(self->_cfg_->port, self->_cfg_->pin_a);
-    GPIO_ResetBits(self->_cfg_->port, self->_cfg_->pin_b);
+    self->_req_ = RelayDirStop;
+    if(self->_dir_ != RelayDirStop) _output(self, RelayDirStop);
+}
+
+/**
+ * @brief   计时并执行挂起的切换
+ * @param   self 电机对象
+ * @param   dt_s 周期 (s)
+ * @retval  None
+ */
+static void _update(Relay* self, float dt_s) {
+    if(self->_elapsed_s_ < RELAY_ELAPSED_MAX_S) self->_elapsed_s_ += dt_s;
+    _apply(self);
+}
+
+/**
+ * @brief   获取当前实际输出方向
+ * @param   self 电机对象
+ * @retval  RelayDir_e 方向
+ */
+static RelayDir_e _get_dir(const Relay* self) {
+    return self->_dir_;
+}
+
+/**
+ * @brief   获取触点寿命统计
+ * @param   self 电机对象
+ * @param   out 输出
+ * @retval  None
+ */
+static void _get_stats(const Relay* self, relay_stats_t* out) {
+    *out = self->_stats_;
+}
+
+/**
+ * @brief   在时间约束允许时向请求方向推进一步
+ * @param   self 电机对象
+ * @retval  None
+ */
+static void _apply(Relay* self) {
+    const relay_cfg_t* cfg = self->_cfg_;
+    RelayDir_e want = self->_req_;
+    if(!cfg || want == self->_dir_) return;
+
+    if(self->_dir_ != RelayDirStop) {
+        /* 接通未满最短时间: 保持 */
+        if(self->_elapsed_s_ + RELAY_TIME_EPS_S < cfg->min_on_s) return;
+        _output(self, RelayDirStop);
+        if(want == RelayDirStop) return;
+    }
+
+    /* 反向: 断开时间未满时等待 */
+    if(self->_last_ != RelayDirStop && want != self->_last_
+        && self->_elapsed_s_ + RELAY_TIME_EPS_S < cfg->min_off_s) return;
+
+    _output(self, want);
+}
+
+/**
+ * @brief   输出方向 (单次 BSRR 写入) 并更新统计
+ * @param   self 电机对象
+ * @param   dir 方向
+ * @retval  None
+ * @note    BSRR 高 16 位复位, 低 16 位置位, 一次写入同时完成两个引脚的切换
+ */
+static void _output(Relay* self, RelayDir_e dir) {
+    const relay_cfg_t* cfg = self->_cfg_;
+    uint32_t set = 0, reset = cfg->pin_a | cfg->pin_b;
+
+    if(dir == RelayDirA) {
+        set = cfg->pin_a;
+        reset = cfg->pin_b;
+    }
+    else if(dir == RelayDirB) {
+        set = cfg->pin_b;
+        reset = cfg->pin_a;
+    }
+    cfg->port->BSRR = set | (reset << 16);
+
+    if(dir != RelayDirStop) {
+        self->_stats_.actuations++;
+        if(self->_last_ != RelayDirStop && dir != self->_last_) self->_stats_.reversals++;
+        self->_last_ = dir;
+    }
+
+    self->_dir_ = dir;
+    self->_elapsed_s_ = 0.0f;
 }
@@ -1,6 +1,13 @@
 /**
  * @file    d_relay.h
  * @brief   继电器驱动
+ * @note    方向切换经调度执行, 保护触点:
+ *
+ *          A ──(≥ min_on)──> 停止 ──(≥ min_off)──> B
+ *
+ *          接通后至少保持 min_on_s 才断开, 反向前至少断开 min_off_s; 不满足时请求被挂起,
+ *          由 update 在条件满足后执行. stop 为紧急停止, 不受最短接通时间限制.
+ *          两个引脚通过一次 BSRR 写入同时切换, 不存在两线圈同时得电的中间状态
  */
 #ifndef _d_relay_h_
 #define _d_relay_h_
@@ -15,6 +22,8 @@ typedef struct {
     GPIO_TypeDef* port;
     uint16_t pin_a;
     uint16_t pin_b;
+    float min_on_s;        /* 最短接通时间 */
+    float min_off_s;       /* 反向前最短断开时间 */
 } relay_cfg_t;
 
 typedef enum {
@@ -23,6 +32,15 @@ typedef enum {
     RelayDirB
 } RelayDir_e;
 
+/**
+ * @brief 触点寿命统计
+ */
+typedef struct {
+    uint32_t actuations;   /* 吸合次数 */
+    uint32_t reversals;    /* 换向次数 */
+    uint32_t deferred;     /* 因最短接通/断开时间被推迟的请求数 */
+} relay_stats_t;
+
 typedef struct Relay Relay;
 struct Relay {
 // public:
@@ -33,21 +51,47 @@ struct Relay {
      */
     void (*init)(Relay* self, const relay_cfg_t* cfg);
     /**
-     * @brief   设置电机方向
+     * @brief   请求电机方向
      * @param   self 电机对象
      * @param   dir 方向
      * @retval  None
+     * @note    满足最短接通/断开时间时立即切换, 否则挂起到 update 中执行
      */
     void (*set_dir)(Relay* self, RelayDir_e dir);
     /**
-     * @brief   停止电机
+     * @brief   立即停止电机 (紧急停止, 不受最短接通时间限制)
      * @param   self 电机对象
      * @retval  None
      */
     void (*stop)(Relay* self);
+    /**
+     * @brief   计时并执行挂起的切换 (每个控制周期调用一次)
+     * @param   self 电机对象
+     * @param   dt_s 周期 (s)
+     * @retval  None
+     */
+    void (*update)(Relay* self, float dt_s);
+    /**
+     * @brief   获取当前实际输出方向
+     * @param   self 电机对象
+     * @retval  RelayDir_e 方向
+     */
+    RelayDir_e (*get_dir)(const Relay* self);
+    /**
+     * @brief   获取触点寿命统计
+     * @param   self 电机对象
+     * @param   out 输出
+     * @retval  None
+     */
+    void (*get_stats)(const Relay* self, relay_stats_t* out);
 
 // private:
     const relay_cfg_t* _cfg_;
+    RelayDir_e _dir_;               // 实际输出
+    RelayDir_e _req_;               // 请求方向
+    RelayDir_e _last_;              // 最近一次接通的方向
+    float _elapsed_s_;              // 当前输出已保持的时间
+    relay_stats_t _stats_;
 };
 
 // ! ========================= 接 口 函 数 声 明 ========================= ! //
@@ -26,6 +26,15 @@ void dwt_init(void) {
     DWT->CYCCNT = 0;
 }
 
+/**
+ * @brief   获取 CPU 周期计数
+ * @param   None
+ * @retval  uint32_t 周期数 (72 MHz 下约 59.6 s 回绕一次)
+ */
+uint32_t dwt_get_cycles(void) {
+    return DWT->CYCCNT;
+}
+
 /**
  * @brief   获取系统运行微秒数
  * @param   None
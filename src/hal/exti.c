@@ -0,0 +1,139 @@
+/**
+ * @file    exti.c
+ * @brief   外部中断 HAL 实现 — 配置表驱动
+ *          引脚号即 EXTI 线号, 同一线号只能映射到一个端口
+ */
+#include "exti.h"
+
+// ! ========================= 变 量 声 明 ========================= ! //
+
+#define EXTI_LINE_COUNT  16
+
+static exti_t* _handles[EXTI_LINE_COUNT] = { 0 };
+
+// ! ========================= 私 有 函 数 声 明 ========================= ! //
+
+static uint8_t _pin_index(uint16_t pin);
+static uint8_t _irqn(uint8_t line);
+static void _exti_irq(uint8_t first, uint8_t last);
+
+// ! ========================= 接 口 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   初始化外部中断 (依据配置表)
+ * @param   handle 句柄
+ * @param   cfg 配置表
+ */
+void exti_init(exti_t* handle, const exti_cfg_t* cfg) {
+    if(!cfg) return;
+
+    uint8_t line = _pin_index(cfg->pin);
+    uint8_t port_source = (uint8_t)(((uint32_t)cfg->port - GPIOA_BASE) / (GPIOB_BASE - GPIOA_BASE));
+
+    handle->cfg = cfg;
+    handle->flag = 0;
+    handle->callback = 0;
+    handle->arg = 0;
+    _handles[line] = handle;
+
+    if(cfg->gpio_rcc_bus == 2)
+        RCC_APB2PeriphClockCmd(cfg->gpio_rcc_mask | RCC_APB2Periph_AFIO, ENABLE);
+    else {
+        RCC_APB1PeriphClockCmd(cfg->gpio_rcc_mask, ENABLE);
+        RCC_APB2PeriphClockCmd(RCC_APB2Periph_AFIO, ENABLE);
+    }
+
+    GPIO_InitTypeDef gpio;
+    gpio.GPIO_Pin = cfg->pin;
+    gpio.GPIO_Speed = GPIO_Speed_50MHz;
+    gpio.GPIO_Mode = cfg->gpio_mode;
+    GPIO_Init(cfg->port, &gpio);
+
+    GPIO_EXTILineConfig(port_source, line);
+
+    EXTI_InitTypeDef ei;
+    ei.EXTI_Line = cfg->pin;        // EXTI_Linex 与 GPIO_Pin_x 位定义一致
+    ei.EXTI_Mode = EXTI_Mode_Interrupt;
+    ei.EXTI_Trigger = cfg->trigger;
+    ei.EXTI_LineCmd = ENABLE;
+    EXTI_ClearITPendingBit(cfg->pin);
+    EXTI_Init(&ei);
+
+    NVIC_InitTypeDef ni;
+    ni.NVIC_IRQChannel = _irqn(line);
+    ni.NVIC_IRQChannelCmd = ENABLE;
+    ni.NVIC_IRQChannelPreemptionPriority = cfg->nvic_preempt;
+    ni.NVIC_IRQChannelSubPriority = cfg->nvic_sub;
+    NVIC_Init(&ni);
+}
+
+/**
+ * @brief   设置外部中断回调
+ * @param   handle 句柄
+ * @param   cb 回调函数
+ * @param   arg 回调参数 (原样传给回调)
+ */
+void exti_set_callback(exti_t* handle, exti_cb_t cb, void* arg) {
+    handle->arg = arg;
+    handle->callback = cb;
+}
+
+/**
+ * @brief   读取引脚电平
+ * @param   handle 句柄
+ * @retval  bool true:高电平, false:低电平
+ */
+bool exti_read_pin(const exti_t* handle) {
+    return GPIO_ReadInputDataBit(handle->cfg->port, handle->cfg->pin) == Bit_SET;
+}
+
+// ! ========================= 私 有 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   引脚掩码 -> 引脚号
+ * @param   pin GPIO_Pin_x
+ * @retval  uint8_t 引脚号 (0 ~ 15)
+ */
+static uint8_t _pin_index(uint16_t pin) {
+    uint8_t i = 0;
+    while(i < EXTI_LINE_COUNT - 1 && !(pin & (1u << i))) i++;
+    return i;
+}
+
+/**
+ * @brief   EXTI 线号 -> 中断号
+ * @param   line 线号
+ * @retval  uint8_t 中断号
+ */
+static uint8_t _irqn(uint8_t line) {
+    if(line <= 4) return (uint8_t)(EXTI0_IRQn + line);
+    if(line <= 9) return EXTI9_5_IRQn;
+    return EXTI15_10_IRQn;
+}
+
+/**
+ * @brief   外部中断服务函数
+ * @param   first 起始线号
+ * @param   last 结束线号
+ * @note    由 EXTIx_IRQHandler 调用, 共享中断向量的线逐一检查
+ */
+static void _exti_irq(uint8_t first, uint8_t last) {
+    for(uint8_t line = first; line <= last; ++line) {
+        uint32_t mask = 1u << line;
+        if(EXTI_GetITStatus(mask) != SET) continue;
+        EXTI_ClearITPendingBit(mask);
+
+        exti_t* handle = _handles[line];
+        if(!handle) continue;
+        handle->flag = 1;
+        if(handle->callback) handle->callback(handle->arg);
+    }
+}
+
+void EXTI0_IRQHandler(void) { _exti_irq(0, 0); }
+void EXTI1_IRQHandler(void) { _exti_irq(1, 1); }
+void EXTI2_IRQHandler(void) { _exti_irq(2, 2); }
+void EXTI3_IRQHandler(void) { _exti_irq(3, 3); }
+void EXTI4_IRQHandler(void) { _exti_irq(4, 4); }
+void EXTI9_5_IRQHandler(void) { _exti_irq(5, 9); }
+void EXTI15_10_IRQHandler(void) { _exti_irq(10, 15); }
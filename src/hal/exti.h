@@ -0,0 +1,47 @@
+/**
+ * @file    exti.h
+ * @brief   外部中断 HAL — 配置表驱动
+ *          支持 EXTI Line 0 ~ 15 (GPIO 输入)
+ */
+#ifndef _exti_h_
+#define _exti_h_
+
+#include "stm32f10x.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+// ! ========================= 接 口 变 量 / Typedef 声 明 ========================= ! //
+
+typedef void (*exti_cb_t)(void* arg);
+
+/**
+ * @brief 外部中断配置表
+ */
+typedef struct {
+    GPIO_TypeDef* port;
+    uint16_t pin;                   // GPIO_Pin_x (单个引脚)
+    uint32_t gpio_rcc_mask;
+    uint8_t gpio_rcc_bus;           // 1=APB1, 2=APB2
+    GPIOMode_TypeDef gpio_mode;     // 一般为 GPIO_Mode_IPU / GPIO_Mode_IPD
+    EXTITrigger_TypeDef trigger;    // EXTI_Trigger_Rising/Falling/Rising_Falling
+    uint8_t nvic_preempt;           // 抢占优先级
+    uint8_t nvic_sub;               // 子优先级
+} exti_cfg_t;
+
+/**
+ * @brief 外部中断运行时句柄
+ */
+typedef struct {
+    const exti_cfg_t* cfg;          // 指向配置表
+    volatile uint8_t flag;          // 中断标志
+    exti_cb_t callback;             // 中断回调
+    void* arg;                      // 回调参数
+} exti_t;
+
+// ! ========================= 接 口 函 数 声 明 ========================= ! //
+
+void exti_init(exti_t* handle, const exti_cfg_t* cfg);
+void exti_set_callback(exti_t* handle, exti_cb_t cb, void* arg);
+bool exti_read_pin(const exti_t* handle);
+
+#endif
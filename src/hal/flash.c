@@ -0,0 +1,76 @@
+/**
+ * @file    flash.c
+ * @brief   片内 Flash 读写 HAL 实现
+ */
+#include "flash.h"
+
+// ! ========================= 变 量 声 明 ========================= ! //
+
+#define FLASH_ERR_FLAGS  (FLASH_FLAG_EOP | FLASH_FLAG_PGERR | FLASH_FLAG_WRPRTERR)
+
+// ! ========================= 私 有 函 数 声 明 ========================= ! //
+
+
+
+// ! ========================= 接 口 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   读取 Flash
+ * @param   addr 起始地址
+ * @param   data 输出缓冲区
+ * @param   len 字节数
+ * @retval  None
+ */
+void flash_read(uint32_t addr, void* data, uint32_t len) {
+    const uint8_t* src = (const uint8_t*)addr;
+    uint8_t* dst = (uint8_t*)data;
+    while(len--) {
+        *dst++ = *src++;
+    }
+}
+
+/**
+ * @brief   擦除一页
+ * @param   addr 页起始地址 (需按 FLASH_PAGE_BYTES 对齐)
+ * @retval  bool true:成功, false:失败
+ */
+bool flash_erase_page(uint32_t addr) {
+    FLASH_Unlock();
+    FLASH_ClearFlag(FLASH_ERR_FLAGS);
+    FLASH_Status st = FLASH_ErasePage(addr);
+    FLASH_Lock();
+    return st == FLASH_COMPLETE;
+}
+
+/**
+ * @brief   写入 Flash (目标区域需已擦除)
+ * @param   addr 起始地址 (需半字对齐)
+ * @param   data 数据
+ * @param   len 字节数 (奇数时末字节高位补 0xFF)
+ * @retval  bool true:写入并校验成功, false:失败
+ */
+bool flash_write(uint32_t addr, const void* data, uint32_t len) {
+    const uint8_t* src = (const uint8_t*)data;
+    bool ok = true;
+
+    FLASH_Unlock();
+    FLASH_ClearFlag(FLASH_ERR_FLAGS);
+    for(uint32_t i = 0; i < len && ok; i += 2) {
+        uint16_t hw = src[i];
+        hw |= (i + 1 < len) ? (uint16_t)(src[i + 1] << 8) : 0xFF00u;
+        if(FLASH_ProgramHalfWord(addr + i, hw) != FLASH_COMPLETE) ok = false;
+    }
+    FLASH_Lock();
+
+    /* 回读校验 */
+    const uint8_t* chk = (const uint8_t*)addr;
+    for(uint32_t i = 0; i < len && ok; ++i) {
+        if(chk[i] != src[i]) ok = false;
+    }
+
+    return ok;
+}
+
+// ! ========================= 私 有 函 数 实 现 ========================= ! //
+
+
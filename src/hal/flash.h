@@ -0,0 +1,25 @@
+/**
+ * @file    flash.h
+ * @brief   片内 Flash 读写 HAL (按页擦除, 半字编程)
+ * @note    擦写期间 CPU 取指停顿 (擦除一页约 20 ms), 中断随之延后,
+ *          应仅在电机停止时调用
+ */
+#ifndef _flash_h_
+#define _flash_h_
+
+#include "stm32f10x.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+// ! ========================= 接 口 变 量 / Typedef 声 明 ========================= ! //
+
+// STM32F103x8 (中容量) 页大小
+#define FLASH_PAGE_BYTES  1024u
+
+// ! ========================= 接 口 函 数 声 明 ========================= ! //
+
+void flash_read(uint32_t addr, void* data, uint32_t len);
+bool flash_erase_page(uint32_t addr);
+bool flash_write(uint32_t addr, const void* data, uint32_t len);
+
+#endif
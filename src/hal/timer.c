@@ -58,6 +58,7 @@ void tim_init(tim_t* handle, const tim_cfg_t* cfg) {
         handle->cfg = cfg;
         handle->flag = 0;
         handle->callback = 0;
+        handle->arg = 0;
         _handles[id] = handle;
     }
     else {
@@ -132,6 +133,13 @@ void tim_init(tim_t* handle, const tim_cfg_t* cfg) {
             oc.TIM_Pulse = pcfg->pulse;
             oc.TIM_OCPolarity = pcfg->oc_polarity;
 
+            if(pcfg->n_port) {
+                _gpio_init(pcfg->n_port, pcfg->n_pin, pcfg->n_gpio_rcc_mask,
+                    pcfg->n_gpio_rcc_bus, pcfg->gpio_mode);
+                oc.TIM_OutputNState = TIM_OutputNState_Enable;
+                oc.TIM_OCNPolarity = pcfg->ocn_polarity;
+            }
+
             switch(pcfg->channel) {
                 case TIM_Channel_1: TIM_OC1Init(hw->periph, &oc); break;
                 case TIM_Channel_2: TIM_OC2Init(hw->periph, &oc); break;
@@ -151,6 +159,20 @@ void tim_init(tim_t* handle, const tim_cfg_t* cfg) {
             }
 
             TIM_ARRPreloadConfig(hw->periph, ENABLE);
+
+            /* 高级定时器: 死区与主输出 (MOE) */
+            if(id == TIM_1) {
+                TIM_BDTRInitTypeDef bdtr;
+                TIM_BDTRStructInit(&bdtr);
+                bdtr.TIM_OSSRState = TIM_OSSRState_Enable;
+                bdtr.TIM_OSSIState = TIM_OSSIState_Enable;
+                bdtr.TIM_LOCKLevel = TIM_LOCKLevel_OFF;
+                bdtr.TIM_DeadTime = pcfg->dead_time;
+                bdtr.TIM_Break = TIM_Break_Disable;
+                bdtr.TIM_AutomaticOutput = TIM_AutomaticOutput_Disable;
+                TIM_BDTRConfig(hw->periph, &bdtr);
+                TIM_CtrlPWMOutputs(hw->periph, ENABLE);
+            }
             break;
         }
         case TIM_MODE_IC: {
@@ -179,11 +201,31 @@ void tim_init(tim_t* handle, const tim_cfg_t* cfg) {
  * @brief   设置定时器中断回调
  * @param   handle 句柄
  * @param   cb 回调函数
+ * @param   arg 回调参数 (原样传给回调)
  */
-void tim_set_callback(tim_t* handle, tim_cb_t cb) {
+void tim_set_callback(tim_t* handle, tim_cb_t cb, void* arg) {
+    handle->arg = arg;
     handle->callback = cb;
 }
 
+/**
+ * @brief   设置 PWM 比较值 (占空比 = pulse / (period + 1))
+ * @param   handle 句柄 (TIM_MODE_OC_PWM)
+ * @param   pulse 比较值, 超过 period + 1 时按 100% 处理
+ */
+void tim_pwm_set_pulse(tim_t* handle, uint16_t pulse) {
+    const tim_cfg_t* cfg = handle->cfg;
+    TIM_TypeDef* periph = _hw[cfg->id].periph;
+
+    switch(cfg->cfg.oc_pwm.channel) {
+        case TIM_Channel_1: TIM_SetCompare1(periph, pulse); break;
+        case TIM_Channel_2: TIM_SetCompare2(periph, pulse); break;
+        case TIM_Channel_3: TIM_SetCompare3(periph, pulse); break;
+        case TIM_Channel_4: TIM_SetCompare4(periph, pulse); break;
+        default: break;
+    }
+}
+
 /**
  * @brief   GPIO 初始化
  * @param   port GPIO 端口
@@ -219,9 +261,10 @@ static void _tim_irq(tim_id_e id) {
     if(!handle) return;
     const tim_hw_t* hw = &_hw[id];
     if(TIM_GetFlagStatus(hw->periph, TIM_FLAG_Update) == SET) {
-        handle->flag = 1;
-        if(handle->callback) handle->callback();
+        // 先清标志再回调, 回调期间发生的新更新事件不会被清掉
         TIM_ClearITPendingBit(hw->periph, TIM_IT_Update);
+        handle->flag = 1;
+        if(handle->callback) handle->callback(handle->arg);
     }
 }
 
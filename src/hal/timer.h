@@ -11,7 +11,7 @@
 
 // ! ========================= 接 口 变 量 / Typedef 声 明 ========================= ! //
 
-typedef void (*tim_cb_t)(void);
+typedef void (*tim_cb_t)(void* arg);
 
 /**
  * @brief 定时器 ID 枚举
@@ -49,6 +49,13 @@ typedef struct {
     uint16_t pulse;             // 占空比
     uint8_t output_state;       // TIM_OutputState_Enable/Disable
     uint8_t preload;            // 1=使能预装载
+    /* 互补输出与死区, 仅高级定时器 (TIM1) 有效 */
+    GPIO_TypeDef* n_port;       // 互补输出端口, 0 = 不使用
+    uint16_t n_pin;
+    uint32_t n_gpio_rcc_mask;
+    uint8_t n_gpio_rcc_bus;     // 1=APB1, 2=APB2
+    uint16_t ocn_polarity;      // TIM_OCNPolarity_x
+    uint8_t dead_time;          // BDTR.DTG 编码, 0 ~ 127 时死区 = dead_time / 72 MHz
 } tim_oc_pwm_cfg_t;
 
 /**
@@ -112,11 +119,13 @@ typedef struct {
     const tim_cfg_t* cfg;   // 指向配置表
     volatile uint8_t flag;  // 中断标志
     tim_cb_t callback;      // 中断回调
+    void* arg;              // 回调参数
 } tim_t;
 
 // ! ========================= 接 口 函 数 声 明 ========================= ! //
 
 void tim_init(tim_t* handle, const tim_cfg_t* cfg);
-void tim_set_callback(tim_t* handle, tim_cb_t cb);
+void tim_set_callback(tim_t* handle, tim_cb_t cb, void* arg);
+void tim_pwm_set_pulse(tim_t* handle, uint16_t pulse);
 
 #endif
@@ -0,0 +1,118 @@
+/**
+ * @file    s_bench.c
+ * @brief   片上性能测量服务实现
+ */
+#include "s_bench.h"
+#include "s_log.h"
+
+// ! ========================= 变 量 声 明 ========================= ! //
+
+static uint32_t(*_get_cycles)(void) = 0;
+static bench_t* _items[BENCH_MAX_ITEMS] = { 0 };
+static uint8_t _item_count = 0;
+
+// ! ========================= 私 有 函 数 声 明 ========================= ! //
+
+static void _clear(bench_t* b);
+
+// ! ========================= 接 口 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   测量服务初始化
+ * @param   get_cycles 获取 CPU 周期计数的函数指针, 例如 dwt_get_cycles
+ * @retval  None
+ */
+void s_bench_init(uint32_t(*get_cycles)(void)) {
+    _get_cycles = get_cycles;
+}
+
+/**
+ * @brief   登记测量条目
+ * @param   b 条目
+ * @param   name 名称 (需长期有效)
+ * @retval  None
+ */
+void s_bench_register(bench_t* b, const char* name) {
+    b->name = name;
+    _clear(b);
+    if(_item_count < BENCH_MAX_ITEMS) {
+        _items[_item_count++] = b;
+    }
+}
+
+/**
+ * @brief   开始一次测量
+ * @param   b 条目
+ * @retval  None
+ */
+void s_bench_begin(bench_t* b) {
+#if BENCH_ENABLE
+    if(_get_cycles) b->start = _get_cycles();
+#else
+    (void)b;
+#endif
+}
+
+/**
+ * @brief   结束一次测量并累计
+ * @param   b 条目
+ * @retval  None
+ */
+void s_bench_end(bench_t* b) {
+#if BENCH_ENABLE
+    if(!_get_cycles) return;
+    uint32_t cycles = _get_cycles() - b->start;
+    b->last = cycles;
+    if(cycles < b->min) b->min = cycles;
+    if(cycles > b->max) b->max = cycles;
+    b->total += cycles;
+    b->count++;
+#else
+    (void)b;
+#endif
+}
+
+/**
+ * @brief   清零所有条目的统计
+ * @param   None
+ * @retval  None
+ */
+void s_bench_reset(void) {
+    for(uint8_t i = 0; i < _item_count; ++i) {
+        _clear(_items[i]);
+    }
+}
+
+/**
+ * @brief   打印所有条目的统计 (单位: CPU 周期)
+ * @param   None
+ * @retval  None
+ */
+void s_bench_report(void) {
+    for(uint8_t i = 0; i < _item_count; ++i) {
+        const bench_t* b = _items[i];
+        if(b->count == 0) {
+            s_log_info("%s: no samples", b->name);
+            continue;
+        }
+        s_log_info("%s: last=%lu min=%lu max=%lu avg=%lu n=%lu", b->name,
+            (unsigned long)b->last, (unsigned long)b->min, (unsigned long)b->max,
+            (unsigned long)(b->total / b->count), (unsigned long)b->count);
+    }
+}
+
+// ! ========================= 私 有 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   清零条目统计
+ * @param   b 条目
+ * @retval  None
+ */
+static void _clear(bench_t* b) {
+    b->start = 0;
+    b->last = 0;
+    b->min = 0xFFFFFFFFu;
+    b->max = 0;
+    b->count = 0;
+    b->total = 0;
+}
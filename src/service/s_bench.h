@@ -0,0 +1,50 @@
+/**
+ * @file    s_bench.h
+ * @brief   片上性能测量服务 (CPU 周期计数)
+ * @note
+ *          -------- 用法 --------
+ *          static bench_t b;
+ *          s_bench_register(&b, "encoder");
+ *          s_bench_begin(&b);
+ *          ... 被测代码 ...
+ *          s_bench_end(&b);
+ *          s_bench_report();   // 打印所有条目的 last/min/max/avg 周期数
+ */
+#ifndef _s_bench_h_
+#define _s_bench_h_
+
+#include <stdint.h>
+
+// ! ========================= 接 口 变 量 / Typedef 声 明 ========================= ! //
+
+// 测量开关 (0 时 begin/end 为空操作)
+#ifndef BENCH_ENABLE
+#define BENCH_ENABLE    1
+#endif
+
+// 最大登记条目数
+#define BENCH_MAX_ITEMS 8
+
+/**
+ * @brief 测量条目
+ */
+typedef struct {
+    const char* name;
+    uint32_t start;         // 本次起始周期
+    uint32_t last;          // 最近一次耗时
+    uint32_t min;
+    uint32_t max;
+    uint32_t count;         // 测量次数
+    uint64_t total;         // 累计耗时
+} bench_t;
+
+// ! ========================= 接 口 函 数 声 明 ========================= ! //
+
+void s_bench_init(uint32_t(*get_cycles)(void));
+void s_bench_register(bench_t* b, const char* name);
+void s_bench_begin(bench_t* b);
+void s_bench_end(bench_t* b);
+void s_bench_reset(void);
+void s_bench_report(void);
+
+#endif
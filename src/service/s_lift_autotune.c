@@ -0,0 +1,230 @@
+/**
+ * @file    s_lift_autotune.c
+ * @brief   升降台继电反馈自整定服务实现
+ */
+#include "s_lift_autotune.h"
+
+#include <math.h>
+
+// ! ========================= 变 量 声 明 ========================= ! //
+
+#define TUNE_PI                 3.14159265f
+
+static LiftTuneStatus_e _status = LiftTuneIdle;
+static LiftTuneErr_e _err = LiftTuneErrNone;
+
+static float _sp;
+static float _hyst;
+static float _d;                    // 继电器输出幅值
+static uint8_t _cycles;
+static LiftTuneRule_e _rule;
+static float _min_mm;
+static float _max_mm;
+static uint32_t _start_ms;
+
+static int8_t _out;                 // 当前输出方向
+static bool _has_up;                // 已出现过上行切换
+static uint32_t _last_up_ms;        // 上一次上行切换时间
+static float _hi;                   // 本周期最高位置
+static float _lo;                   // 本周期最低位置
+static uint8_t _skip;               // 待丢弃的过渡周期数
+static uint8_t _n;                  // 已记录周期数
+
+static float _period[LIFT_TUNE_MAX_CYCLES];
+static float _amp[LIFT_TUNE_MAX_CYCLES];
+
+static lift_tune_result_t _result;
+
+// ! ========================= 私 有 函 数 声 明 ========================= ! //
+
+static void _fail(LiftTuneErr_e err);
+static void _finish(void);
+
+// ! ========================= 接 口 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   开始整定
+ * @param   setpoint_mm 振荡中心
+ * @param   hyst_mm 回差 (抑制编码器量化抖动)
+ * @param   relay_amp 继电器输出幅值 (PID 输出单位)
+ * @param   cycles 计入的周期数 (1 ~ LIFT_TUNE_MAX_CYCLES)
+ * @param   rule 整定规则
+ * @param   min_mm 允许的最低位置
+ * @param   max_mm 允许的最高位置
+ * @param   now_ms 当前时间
+ * @retval  None
+ */
+void s_lift_autotune_start(float setpoint_mm, float hyst_mm, float relay_amp, uint8_t cycles,
+    LiftTuneRule_e rule, float min_mm, float max_mm, uint32_t now_ms) {
+    if(cycles < 1) cycles = 1;
+    if(cycles > LIFT_TUNE_MAX_CYCLES) cycles = LIFT_TUNE_MAX_CYCLES;
+
+    _sp = setpoint_mm;
+    _hyst = hyst_mm;
+    _d = relay_amp;
+    _cycles = cycles;
+    _rule = rule;
+    _min_mm = min_mm;
+    _max_mm = max_mm;
+    _start_ms = now_ms;
+
+    _out = 1;
+    _has_up = false;
+    _hi = setpoint_mm;
+    _lo = setpoint_mm;
+    _skip = 1;
+    _n = 0;
+    _err = LiftTuneErrNone;
+    _status = LiftTuneRunning;
+    if(!(min_mm < setpoint_mm && setpoint_mm < max_mm)) _fail(LiftTuneErrRange);
+}
+
+/**
+ * @brief   整定周期处理
+ * @param   pos_mm 当前位置
+ * @param   now_ms 当前时间
+ * @retval  int8_t 应驱动的方向: 1 上行, -1 下行, 0 停止 (结束或失败)
+ */
+int8_t s_lift_autotune_update(float pos_mm, uint32_t now_ms) {
+    if(_status != LiftTuneRunning) return 0;
+
+    if(now_ms - _start_ms > LIFT_TUNE_TIMEOUT_MS) {
+        _fail(LiftTuneErrTimeout);
+        return 0;
+    }
+    if(pos_mm < _min_mm || pos_mm > _max_mm) {
+        _fail(LiftTuneErrRange);
+        return 0;
+    }
+
+    if(pos_mm > _hi) _hi = pos_mm;
+    if(pos_mm < _lo) _lo = pos_mm;
+
+    if(_out > 0 && pos_mm > _sp + _hyst) {
+        _out = -1;
+    }
+    else if(_out < 0 && pos_mm < _sp - _hyst) {
+        _out = 1;
+
+        /* 上行切换: 结束一个完整周期 */
+        if(_has_up) {
+            if(_skip) {
+                _skip--;
+            }
+            else {
+                _period[_n] = (float)(now_ms - _last_up_ms) * 0.001f;
+                _amp[_n] = 0.5f * (_hi - _lo);
+                if(++_n >= _cycles) {
+                    _finish();
+                    return 0;
+                }
+            }
+        }
+        _has_up = true;
+        _last_up_ms = now_ms;
+        _hi = pos_mm;
+        _lo = pos_mm;
+    }
+
+    return _out;
+}
+
+/**
+ * @brief   中止整定
+ * @param   None
+ * @retval  None
+ */
+void s_lift_autotune_abort(void) {
+    if(_status == LiftTuneRunning) _fail(LiftTuneErrAborted);
+}
+
+/**
+ * @brief   获取整定状态
+ * @param   None
+ * @retval  LiftTuneStatus_e 状态
+ */
+LiftTuneStatus_e s_lift_autotune_status(void) {
+    return _status;
+}
+
+/**
+ * @brief   获取失败原因
+ * @param   None
+ * @retval  LiftTuneErr_e 原因
+ */
+LiftTuneErr_e s_lift_autotune_error(void) {
+    return _err;
+}
+
+/**
+ * @brief   获取整定结果
+ * @param   out 输出
+ * @retval  bool true:整定成功且结果有效
+ * @note    周期重复性不达标时仍输出测量值, 便于排查
+ */
+bool s_lift_autotune_result(lift_tune_result_t* out) {
+    *out = _result;
+    return _status == LiftTuneDone;
+}
+
+// ! ========================= 私 有 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   整定失败
+ * @param   err 原因
+ * @retval  None
+ */
+static void _fail(LiftTuneErr_e err) {
+    _err = err;
+    _status = LiftTuneFailed;
+}
+
+/**
+ * @brief   全部周期采集完成, 计算临界参数与 PID 增益
+ * @param   None
+ * @retval  None
+ */
+static void _finish(void) {
+    float tu = 0.0f, a = 0.0f, lo = _period[0], hi = _period[0];
+    for(uint8_t i = 0; i < _n; ++i) {
+        tu += _period[i];
+        a += _amp[i];
+        if(_period[i] < lo) lo = _period[i];
+        if(_period[i] > hi) hi = _period[i];
+    }
+    tu /= _n;
+    a /= _n;
+
+    _result.tu_s = tu;
+    _result.amp_mm = a;
+    _result.ku = 0.0f;
+    _result.kp = _result.ki = _result.kd = 0.0f;
+
+    if((hi - lo) > LIFT_TUNE_MAX_SPREAD * tu) {
+        _fail(LiftTuneErrSpread);
+        return;
+    }
+    if(a <= _hyst) {
+        _fail(LiftTuneErrAmplitude);
+        return;
+    }
+
+    float ku = 4.0f * _d / (TUNE_PI * sqrtf(a * a - _hyst * _hyst));
+    float kp, ti, td;
+    if(_rule == LiftTuneRuleZN) {
+        kp = 0.6f * ku;
+        ti = 0.5f * tu;
+        td = 0.125f * tu;
+    }
+    else {
+        kp = ku / 3.2f;
+        ti = 2.2f * tu;
+        td = tu / 6.3f;
+    }
+
+    _result.ku = ku;
+    _result.kp = kp;
+    _result.ki = kp / ti;
+    _result.kd = kp * td;
+    _status = LiftTuneDone;
+}
@@ -0,0 +1,78 @@
+/**
+ * @file    s_lift_autotune.h
+ * @brief   升降台继电反馈自整定服务 (Åström–Hägglund)
+ * @note    以继电器代替控制器, 围绕设定点做带回差的开关控制, 系统进入极限环:
+ *
+ *          位置 ^     __        __        __
+ *               |    /  \      /  \      /  \        振幅 a: 每周期 (最高 - 最低) / 2
+ *          sp+h |---/----\----/----\----/----\--     周期 Tu: 相邻两次上行切换间隔
+ *          sp-h |--/------\--/------\--/------\-
+ *               | /        \/        \/
+ *               +-------------------------------> t
+ *
+ *          输出幅值 d (PID 输出单位, 继电器为 ±1), 临界增益 Ku = 4d / (π · sqrt(a^2 - h^2)).
+ *          第一个周期为过渡过程, 不计入; 周期重复性不达标时失败. 整定规则:
+ *
+ *          规则                Kp          Ti          Td
+ *          Ziegler-Nichols     0.6 Ku      Tu / 2      Tu / 8
+ *          Tyreus-Luyben       Ku / 3.2    2.2 Tu      Tu / 6.3
+ */
+#ifndef _s_lift_autotune_h_
+#define _s_lift_autotune_h_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// ! ========================= 接 口 变 量 / Typedef 声 明 ========================= ! //
+
+// 最大计入周期数
+#define LIFT_TUNE_MAX_CYCLES    8
+// 周期重复性要求: (最大 - 最小) / 均值 上限
+#define LIFT_TUNE_MAX_SPREAD    0.2f
+// 整定总超时 (ms)
+#define LIFT_TUNE_TIMEOUT_MS    60000u
+
+typedef enum {
+    LiftTuneRuleZN = 0,             // Ziegler-Nichols: 响应快, 超调大
+    LiftTuneRuleTL                  // Tyreus-Luyben: 保守, 适合定位
+} LiftTuneRule_e;
+
+typedef enum {
+    LiftTuneIdle = 0,
+    LiftTuneRunning,
+    LiftTuneDone,
+    LiftTuneFailed
+} LiftTuneStatus_e;
+
+typedef enum {
+    LiftTuneErrNone = 0,
+    LiftTuneErrTimeout,             // 未形成稳定极限环
+    LiftTuneErrRange,               // 振荡超出允许范围
+    LiftTuneErrSpread,              // 周期重复性不达标
+    LiftTuneErrAmplitude,           // 振幅不大于回差, 无法计算
+    LiftTuneErrAborted              // 被停止命令中断
+} LiftTuneErr_e;
+
+/**
+ * @brief 整定结果
+ */
+typedef struct {
+    float ku;                       // 临界增益 (输出 / mm)
+    float tu_s;                     // 临界周期
+    float amp_mm;                   // 振幅均值
+    float kp;
+    float ki;
+    float kd;
+} lift_tune_result_t;
+
+// ! ========================= 接 口 函 数 声 明 ========================= ! //
+
+void s_lift_autotune_start(float setpoint_mm, float hyst_mm, float relay_amp, uint8_t cycles,
+    LiftTuneRule_e rule, float min_mm, float max_mm, uint32_t now_ms);
+int8_t s_lift_autotune_update(float pos_mm, uint32_t now_ms);
+void s_lift_autotune_abort(void);
+LiftTuneStatus_e s_lift_autotune_status(void);
+LiftTuneErr_e s_lift_autotune_error(void);
+bool s_lift_autotune_result(lift_tune_result_t* out);
+
+#endif
@@ -0,0 +1,202 @@
+/**
+ * @file    s_lift_calib.c
+ * @brief   升降台编码器标定服务实现
+ */
+#include "s_lift_calib.h"
+
+// ! ========================= 变 量 声 明 ========================= ! //
+
+// 两次标记之间允许的最大行程 (相对间距的倍数)
+#define CALIB_OVERTRAVEL_RATIO  2.0f
+
+static LiftCalibStatus_e _status = LiftCalibIdle;
+static LiftCalibErr_e _err = LiftCalibErrNone;
+
+static float _span_mm;
+static uint8_t _cycles;
+static int64_t _max_travel;         // 两次标记间最大行程 (脉冲)
+
+static uint8_t _mark_idx;           // 已记录标记数
+static int64_t _last_pulses;        // 上一次标记 (或启动) 时的脉冲数
+static uint32_t _last_ms;           // 上一次标记 (或启动) 时间
+
+static float _up[LIFT_CALIB_MAX_CYCLES];
+static float _down[LIFT_CALIB_MAX_CYCLES];
+
+static lift_calib_result_t _result;
+
+// ! ========================= 私 有 函 数 声 明 ========================= ! //
+
+static void _fail(LiftCalibErr_e err);
+static void _finish(void);
+static void _stats(const float* v, uint8_t n, float* mean, float* spread);
+
+// ! ========================= 接 口 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   开始标定
+ * @param   span_mm 两参考位置间距 (mm)
+ * @param   cycles 往返次数 (1 ~ LIFT_CALIB_MAX_CYCLES)
+ * @param   nominal_ppm 当前每毫米脉冲数 (仅用于漏标检测)
+ * @param   pulses 当前脉冲数
+ * @param   now_ms 当前时间
+ * @retval  None
+ */
+void s_lift_calib_start(float span_mm, uint8_t cycles, float nominal_ppm, int64_t pulses, uint32_t now_ms) {
+    if(cycles < 1) cycles = 1;
+    if(cycles > LIFT_CALIB_MAX_CYCLES) cycles = LIFT_CALIB_MAX_CYCLES;
+
+    _span_mm = span_mm;
+    _cycles = cycles;
+    _max_travel = (int64_t)(span_mm * nominal_ppm * CALIB_OVERTRAVEL_RATIO);
+    _mark_idx = 0;
+    _last_pulses = pulses;
+    _last_ms = now_ms;
+    _err = LiftCalibErrNone;
+    _status = (span_mm > 0.0f && nominal_ppm > 0.0f) ? LiftCalibRunning : LiftCalibIdle;
+}
+
+/**
+ * @brief   记录一次参考位置标记
+ * @param   pulses 经过参考位置时的脉冲数
+ * @param   now_ms 当前时间
+ * @retval  None
+ */
+void s_lift_calib_mark(int64_t pulses, uint32_t now_ms) {
+    if(_status != LiftCalibRunning) return;
+
+    /* 奇数标记结束一个样本 */
+    if(_mark_idx & 1u) {
+        int64_t delta = pulses - _last_pulses;
+        uint8_t k = _mark_idx >> 1;     // 第 k 个样本
+        uint8_t cycle = k >> 1;
+
+        if(k & 1u) {
+            if(delta >= 0) { _fail(LiftCalibErrPolarity); return; }
+            _down[cycle] = (float)(-delta) / _span_mm;
+        }
+        else {
+            if(delta <= 0) { _fail(LiftCalibErrPolarity); return; }
+            _up[cycle] = (float)delta / _span_mm;
+        }
+    }
+
+    _last_pulses = pulses;
+    _last_ms = now_ms;
+    _mark_idx++;
+
+    if(_mark_idx >= (uint8_t)(_cycles * 4u)) {
+        _finish();
+    }
+}
+
+/**
+ * @brief   标定周期处理
+ * @param   pulses 当前脉冲数
+ * @param   now_ms 当前时间
+ * @retval  int8_t 应驱动的方向: 1 上行, -1 下行, 0 停止
+ */
+int8_t s_lift_calib_update(int64_t pulses, uint32_t now_ms) {
+    if(_status != LiftCalibRunning) return 0;
+
+    if(now_ms - _last_ms > LIFT_CALIB_MARK_TIMEOUT_MS) {
+        _fail(LiftCalibErrTimeout);
+        return 0;
+    }
+
+    int64_t travel = pulses - _last_pulses;
+    if(travel < 0) travel = -travel;
+    if(travel > _max_travel) {
+        _fail(LiftCalibErrOvertravel);
+        return 0;
+    }
+
+    /* 标记 0,1 上行; 2,3 下行; ... 即每两个标记换向一次 */
+    return ((_mark_idx >> 1) & 1u) ? -1 : 1;
+}
+
+/**
+ * @brief   中止标定
+ * @param   None
+ * @retval  None
+ */
+void s_lift_calib_abort(void) {
+    if(_status == LiftCalibRunning) _fail(LiftCalibErrAborted);
+}
+
+/**
+ * @brief   获取标定状态
+ * @param   None
+ * @retval  LiftCalibStatus_e 状态
+ */
+LiftCalibStatus_e s_lift_calib_status(void) {
+    return _status;
+}
+
+/**
+ * @brief   获取失败原因
+ * @param   None
+ * @retval  LiftCalibErr_e 原因
+ */
+LiftCalibErr_e s_lift_calib_error(void) {
+    return _err;
+}
+
+/**
+ * @brief   获取标定结果
+ * @param   out 输出
+ * @retval  bool true:标定成功且结果有效, false:无有效结果
+ * @note    重复性不达标时仍输出统计量 (状态为 Failed, 原因为 Spread), 便于排查
+ */
+bool s_lift_calib_result(lift_calib_result_t* out) {
+    *out = _result;
+    return _status == LiftCalibDone;
+}
+
+// ! ========================= 私 有 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   标定失败
+ * @param   err 原因
+ * @retval  None
+ */
+static void _fail(LiftCalibErr_e err) {
+    _err = err;
+    _status = LiftCalibFailed;
+}
+
+/**
+ * @brief   全部样本采集完成, 计算结果并检查重复性
+ * @param   None
+ * @retval  None
+ */
+static void _finish(void) {
+    _stats(_up, _cycles, &_result.ppm_up, &_result.spread_up);
+    _stats(_down, _cycles, &_result.ppm_down, &_result.spread_down);
+
+    if(_result.spread_up > LIFT_CALIB_MAX_SPREAD || _result.spread_down > LIFT_CALIB_MAX_SPREAD) {
+        _fail(LiftCalibErrSpread);
+        return;
+    }
+
+    _status = LiftCalibDone;
+}
+
+/**
+ * @brief   计算均值与相对极差
+ * @param   v 样本
+ * @param   n 样本数
+ * @param   mean 均值输出
+ * @param   spread 相对极差输出 ((最大 - 最小) / 均值)
+ * @retval  None
+ */
+static void _stats(const float* v, uint8_t n, float* mean, float* spread) {
+    float sum = 0.0f, lo = v[0], hi = v[0];
+    for(uint8_t i = 0; i < n; ++i) {
+        sum += v[i];
+        if(v[i] < lo) lo = v[i];
+        if(v[i] > hi) hi = v[i];
+    }
+    *mean = sum / n;
+    *spread = (*mean > 0.0f) ? (hi - lo) / *mean : 1.0f;
+}
@@ -0,0 +1,65 @@
+/**
+ * @file    s_lift_calib.h
+ * @brief   升降台编码器标定服务
+ * @note    在上下两个参考位置之间往返运行, 每经过一个参考位置记录一次标记:
+ *
+ *          标记序号:   0    1        2    3        4    5  ...
+ *          参考位置:  下 -> 上  |   上 -> 下  |   下 -> 上  ...
+ *          运行方向:     上行    |     下行    |     上行
+ *
+ *          每对标记 (2k, 2k+1) 给出一个样本 |Δ脉冲| / 间距; 奇数标记后换向.
+ *          标记来源: 上位机确认 (人工/外部传感器) 或限位开关.
+ *          启动前应将平台置于下参考位置稍下方
+ */
+#ifndef _s_lift_calib_h_
+#define _s_lift_calib_h_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// ! ========================= 接 口 变 量 / Typedef 声 明 ========================= ! //
+
+// 最大往返次数
+#define LIFT_CALIB_MAX_CYCLES   5
+// 重复性要求: 同方向样本 (最大 - 最小) / 均值 上限
+#define LIFT_CALIB_MAX_SPREAD   0.01f
+// 两次标记之间的最长时间 (ms)
+#define LIFT_CALIB_MARK_TIMEOUT_MS  30000u
+
+typedef enum {
+    LiftCalibIdle = 0,
+    LiftCalibRunning,
+    LiftCalibDone,
+    LiftCalibFailed
+} LiftCalibStatus_e;
+
+typedef enum {
+    LiftCalibErrNone = 0,
+    LiftCalibErrTimeout,            // 等待标记超时
+    LiftCalibErrOvertravel,         // 行程超出预期仍未标记 (漏标)
+    LiftCalibErrPolarity,           // 上行计数减少: 编码器方向接反
+    LiftCalibErrSpread,             // 重复性不达标
+    LiftCalibErrAborted             // 被停止命令中断
+} LiftCalibErr_e;
+
+/**
+ * @brief 标定结果
+ */
+typedef struct {
+    float ppm_up;                   // 上行每毫米脉冲数 (均值)
+    float ppm_down;                 // 下行每毫米脉冲数 (均值)
+    float spread_up;                // 上行样本相对极差
+    float spread_down;              // 下行样本相对极差
+} lift_calib_result_t;
+
+// ! ========================= 接 口 函 数 声 明 ========================= ! //
+
+void s_lift_calib_start(float span_mm, uint8_t cycles, float nominal_ppm, int64_t pulses, uint32_t now_ms);
+void s_lift_calib_mark(int64_t pulses, uint32_t now_ms);
+int8_t s_lift_calib_update(int64_t pulses, uint32_t now_ms);
+void s_lift_calib_abort(void);
+LiftCalibStatus_e s_lift_calib_status(void);
+LiftCalibErr_e s_lift_calib_error(void);
+bool s_lift_calib_result(lift_calib_result_t* out);
+
+#endif
@@ -0,0 +1,136 @@
+/**
+ * @file    s_lift_coast.c
+ * @brief   升降台停车惯性模型实现
+ */
+#include "s_lift_coast.h"
+
+// ! ========================= 变 量 声 明 ========================= ! //
+
+// 单次样本允许的滑行系数上限 (s), 超出视为异常 (被外力推动等)
+#define COAST_K_MAX_S   2.0f
+
+static const lift_coast_cfg_t* _cfg = 0;
+
+static float _k_up = 0.0f;
+static float _k_down = 0.0f;
+
+static int8_t _last_dir = 0;        // 上一周期指令方向
+static int8_t _coast_dir = 0;       // 正在观测的停车方向, 0 表示未观测
+static float _start_mm;             // 断开时位置
+static float _start_speed;          // 断开时速度 (沿运动方向, mm/s)
+static uint8_t _still_cnt;
+static uint16_t _coast_ticks;
+
+// ! ========================= 私 有 函 数 声 明 ========================= ! //
+
+static void _learn(float pos_mm);
+
+// ! ========================= 接 口 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   初始化惯性模型
+ * @param   cfg 模型参数
+ * @retval  None
+ */
+void s_lift_coast_init(const lift_coast_cfg_t* cfg) {
+    _cfg = cfg;
+    _k_up = cfg->k_up_s;
+    _k_down = cfg->k_down_s;
+    _last_dir = 0;
+    _coast_dir = 0;
+}
+
+/**
+ * @brief   惯性模型周期处理 (每个控制周期调用一次)
+ * @param   dir 当前指令方向: 1 上行, -1 下行, 0 停止
+ * @param   pos_mm 当前位置
+ * @param   speed_mm_s 当前速度 (上行为正)
+ * @retval  None
+ * @note    自动识别驱动 -> 停止的跳变, 对所有来源的停车 (状态机/手动命令) 都进行学习
+ */
+void s_lift_coast_update(int8_t dir, float pos_mm, float speed_mm_s) {
+    if(!_cfg) return;
+
+    if(dir != _last_dir) {
+        _coast_dir = 0;
+        if(dir == 0) {
+            float v = _last_dir > 0 ? speed_mm_s : -speed_mm_s;
+            if(v >= _cfg->min_speed_mm_s) {
+                _coast_dir = _last_dir;
+                _start_mm = pos_mm;
+                _start_speed = v;
+                _still_cnt = 0;
+                _coast_ticks = 0;
+            }
+        }
+        _last_dir = dir;
+        return;
+    }
+
+    if(!_coast_dir) return;
+
+    if(++_coast_ticks > _cfg->timeout_ticks) {
+        _coast_dir = 0;
+        return;
+    }
+
+    float v = speed_mm_s >= 0.0f ? speed_mm_s : -speed_mm_s;
+    _still_cnt = v < _cfg->still_speed_mm_s ? (uint8_t)(_still_cnt + 1) : 0;
+    if(_still_cnt >= _cfg->still_ticks) {
+        _learn(pos_mm);
+        _coast_dir = 0;
+    }
+}
+
+/**
+ * @brief   预测此刻断开继电器后的滑行距离
+ * @param   dir 指令方向: 1 上行, -1 下行
+ * @param   speed_mm_s 当前速度 (上行为正)
+ * @param   accel_mm_s2 当前加速度 (上行为正)
+ * @retval  float 沿运动方向的滑行距离 (mm, ≥ 0); 未初始化时为 0
+ */
+float s_lift_coast_predict(int8_t dir, float speed_mm_s, float accel_mm_s2) {
+    if(!_cfg) return 0.0f;
+
+    float v = speed_mm_s + accel_mm_s2 * _cfg->lead_s;
+    if(dir < 0) v = -v;
+    if(v <= 0.0f) return 0.0f;
+    return (dir > 0 ? _k_up : _k_down) * v;
+}
+
+/**
+ * @brief   获取当前滑行系数
+ * @param   dir 方向: 1 上行, -1 下行
+ * @retval  float 滑行系数 (s)
+ */
+float s_lift_coast_get_k(int8_t dir) {
+    return dir > 0 ? _k_up : _k_down;
+}
+
+/**
+ * @brief   停车滑行是否已结束
+ * @param   None
+ * @retval  bool true:未在观测滑行 (已静止并完成学习, 或超时放弃)
+ * @note    滑行结束前再次驱动会丢弃本次样本, 调用方应等待
+ */
+bool s_lift_coast_settled(void) {
+    return _coast_dir == 0;
+}
+
+// ! ========================= 私 有 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   以实测滑行距离更新滑行系数
+ * @param   pos_mm 静止后位置
+ * @retval  None
+ */
+static void _learn(float pos_mm) {
+    float dist = (pos_mm - _start_mm) * (float)_coast_dir;
+    if(dist < 0.0f) return;
+
+    float k = dist / _start_speed;
+    if(k > COAST_K_MAX_S) return;
+
+    float* target = _coast_dir > 0 ? &_k_up : &_k_down;
+    *target += _cfg->learn_rate * (k - *target);
+}
@@ -0,0 +1,43 @@
+/**
+ * @file    s_lift_coast.h
+ * @brief   升降台停车惯性模型
+ * @note    继电器断开后平台仍会滑行一段距离. 电机近似一阶惯性 (粘滞阻尼),
+ *          从速度 v 开始自由减速的滑行距离为 v·τ, 再加上继电器释放延时 t_d·v, 因此
+ *
+ *              滑行距离 = k_dir · |v|        (k_dir 单位: s)
+ *
+ *          重力使上行与下行的 k 不同, 分方向学习. 每次继电器由驱动变为停止时记录
+ *          起始位置与速度, 平台静止后以实测滑行距离更新 k (指数滑动平均).
+ *          加速段速度估计滞后且继电器释放前仍在加速, 预测时按 v + a·lead 外推断开时刻的速度
+ */
+#ifndef _s_lift_coast_h_
+#define _s_lift_coast_h_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// ! ========================= 接 口 变 量 / Typedef 声 明 ========================= ! //
+
+/**
+ * @brief 惯性模型参数
+ */
+typedef struct {
+    float k_up_s;                   // 上行初始滑行系数 (s)
+    float k_down_s;                 // 下行初始滑行系数 (s)
+    float learn_rate;               // 学习率 (0 ~ 1)
+    float lead_s;                   // 速度外推时间 (s): 速度估计滞后 + 继电器释放延时
+    float min_speed_mm_s;           // 低于此断开速度的停车不参与学习
+    float still_speed_mm_s;         // 静止判定速度
+    uint8_t still_ticks;            // 连续静止周期数
+    uint16_t timeout_ticks;         // 等待静止的最长周期数
+} lift_coast_cfg_t;
+
+// ! ========================= 接 口 函 数 声 明 ========================= ! //
+
+void s_lift_coast_init(const lift_coast_cfg_t* cfg);
+void s_lift_coast_update(int8_t dir, float pos_mm, float speed_mm_s);
+float s_lift_coast_predict(int8_t dir, float speed_mm_s, float accel_mm_s2);
+float s_lift_coast_get_k(int8_t dir);
+bool s_lift_coast_settled(void);
+
+#endif
@@ -0,0 +1,384 @@
+/**
+ * @file    s_lift_ctrl.c
+ * @brief   升降台位置闭环控制服务实现
+ */
+#include "s_lift_ctrl.h"
+#include "s_lift_ff.h"
+
+#include <math.h>
+
+// ! ========================= 变 量 声 明 ========================= ! //
+
+static const lift_ctrl_cfg_t* _cfg = 0;
+#if LIFT_CTRL_PID_Q16
+static PIDQ16 _pid;
+#else
+static PID _pid;
+#endif
+static PID _vel_pid;                // 串级内环 (速度环)
+static bool _cascade = false;
+static uint8_t _outer_tick;         // 位置环分频计数
+static float _outer_dt;             // 距上次位置环计算的时间
+static float _vel_cmd;              // 位置环输出的速度指令 (mm/s)
+static int8_t _vel_sat;             // 速度环饱和方向 (仍要求同向加速时), 0 = 未饱和
+
+static float _target;               // 最终目标 (变化时重新统计)
+static float _duty;                 // 最近一次 PID 输出
+static uint8_t _tick;               // 窗口内周期序号
+static uint8_t _on_ticks;           // 本窗口接通周期数
+static int8_t _dir;                 // 本窗口驱动方向
+
+static float _elapsed_s;            // 已用时间
+static float _settle_s;             // 最后一次进入误差带的时刻
+static float _in_band_s;            // 连续处于误差带内的时间
+static float _start_sign;           // 初始误差符号, 用于判断越过目标
+static float _overshoot;
+static float _err_sq_sum;
+static uint32_t _samples;
+static float _last_err;
+
+// ! ========================= 私 有 函 数 声 明 ========================= ! //
+
+static void _restart_stats(float target_mm, float pos_mm);
+static void _set_feedforward(float ff);
+static float _duty_ff(float vel_mm_s, float acc_mm_s2, float speed_mm_s);
+static float _outer_calc(float ref_mm, float pos_mm, float dt_s);
+static float _cascade_update(float ref_mm, float ref_vel_mm_s, float ref_acc_mm_s2, float pos_mm, float speed_mm_s,
+    float dt_s);
+static float _actuate(void);
+
+// ! ========================= 接 口 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   初始化位置控制
+ * @param   cfg 控制参数
+ * @param   pid_cfg 位置 PID 参数表 (单环: 输出限幅到 ±1; 串级: 输出为速度指令, 限幅到允许的最大速度)
+ * @param   vel_pid_cfg 速度 PID 参数表 (输出限幅到 ±1), 0 = 单环
+ * @retval  None
+ */
+void s_lift_ctrl_init(const lift_ctrl_cfg_t* cfg, const pid_cfg_t* pid_cfg, const pid_cfg_t* vel_pid_cfg) {
+    _cfg = cfg;
+    _cascade = (vel_pid_cfg != 0);
+#if LIFT_CTRL_PID_Q16
+    float outer_period_s = cfg->period_s;
+    if(_cascade && cfg->outer_div > 1) outer_period_s *= (float)cfg->outer_div;
+    _pid = pid_q16_create();
+    _pid.init_cfg(&_pid, pid_cfg, outer_period_s);
+#else
+    _pid = pid_create();
+    _pid.init_cfg(&_pid, pid_cfg);
+#endif
+    _vel_pid = pid_create();
+    if(_cascade) _vel_pid.init_cfg(&_vel_pid, vel_pid_cfg);
+    s_lift_ctrl_start(0.0f, 0.0f, 0.0f, 0.0f, 0.0f);
+}
+
+/**
+ * @brief   开始一次定位 (清除统计, PID 从当前输出无扰接续)
+ * @param   target_mm 目标位置
+ * @param   pos_mm 当前位置 (即首个参考位置)
+ * @param   speed_mm_s 当前速度
+ * @param   ref_vel_mm_s 首个参考速度 (轨迹从当前速度开始时即当前速度)
+ * @param   u0 当前实际驱动指令 (静止时为 0, 点动中切换为点动输出)
+ * @retval  None
+ * @note    运动中切换时 u0 主要由速度前馈承担, 反馈部分只剩差值,
+ *          到达目标、前馈归零后不会残留需要积分慢慢消除的偏置;
+ *          串级时位置环从当前速度接续, 速度环从 u0 接续
+ */
+void s_lift_ctrl_start(float target_mm, float pos_mm, float speed_mm_s, float ref_vel_mm_s, float u0) {
+    _pid.reset(&_pid);
+    if(_cascade) {
+        _set_feedforward(ref_vel_mm_s);
+        _pid.track(&_pid, speed_mm_s, pos_mm, pos_mm);
+        _vel_cmd = speed_mm_s;
+        _vel_sat = 0;
+        _outer_tick = 0;
+        _outer_dt = 0.0f;
+
+        _vel_pid.reset(&_vel_pid);
+        _vel_pid.set_feedforward(&_vel_pid, _duty_ff(_vel_cmd, 0.0f, speed_mm_s));
+        _vel_pid.track(&_vel_pid, u0, _vel_cmd, speed_mm_s);
+    }
+    else {
+        _set_feedforward(_duty_ff(ref_vel_mm_s, 0.0f, speed_mm_s));
+        /* 参考从当前位置开始, 首个周期输出即 u0 */
+        _pid.track(&_pid, u0, pos_mm, pos_mm);
+    }
+
+    _duty = u0;
+    _tick = 0;
+    _on_ticks = 0;
+    _dir = 0;
+
+    _restart_stats(target_mm, pos_mm);
+}
+
+/**
+ * @brief   位置控制周期处理 (每个控制周期调用一次)
+ * @param   target_mm 最终目标位置 (用于到位判定与统计)
+ * @param   ref_mm 本周期参考位置 (PID 设定值)
+ * @param   ref_vel_mm_s 本周期参考速度 (速度前馈)
+ * @param   ref_acc_mm_s2 本周期参考加速度 (前馈模型惯性项)
+ * @param   pos_mm 当前位置
+ * @param   speed_mm_s 当前速度 (串级速度环反馈)
+ * @param   dt_s 距上次调用的实际时间 (s)
+ * @retval  float 驱动指令: 时间比例方式为 1 / -1 / 0, 直接方式为占空比 (-1 ~ 1)
+ * @note    运动中更换目标只重新统计, 不清除 PID 状态, 参考连续时输出也连续
+ */
+float s_lift_ctrl_update(float target_mm, float ref_mm, float ref_vel_mm_s, float ref_acc_mm_s2, float pos_mm, float speed_mm_s,
+    float dt_s) {
+    if(!_cfg) return 0;
+
+    if(target_mm != _target) {
+        _restart_stats(target_mm, pos_mm);
+    }
+
+    if(_cascade) {
+        _duty = _cascade_update(ref_mm, ref_vel_mm_s, ref_acc_mm_s2, pos_mm, speed_mm_s, dt_s);
+    }
+    else {
+        _set_feedforward(_duty_ff(ref_vel_mm_s, ref_acc_mm_s2, speed_mm_s));
+        _duty = _outer_calc(ref_mm, pos_mm, dt_s);
+    }
+
+    /* 统计 */
+    float track = ref_mm - pos_mm;
+    float err = target_mm - pos_mm;
+    _elapsed_s += dt_s;
+    _err_sq_sum += track * track;
+    _samples++;
+    _last_err = err;
+
+    float over = -err * _start_sign;
+    if(over > _overshoot) _overshoot = over;
+
+    if(fabsf(err) <= _cfg->settle_band_mm) {
+        if(_in_band_s == 0.0f) _settle_s = _elapsed_s;
+        _in_band_s += dt_s;
+    }
+    else {
+        _in_band_s = 0.0f;
+    }
+
+    return _actuate();
+}
+
+/**
+ * @brief   开环输出 (辨识试验用): 给定占空比经时间比例方式输出
+ * @param   duty 占空比 (-1 ~ 1)
+ * @retval  float 本周期驱动指令, 同 s_lift_ctrl_update
+ */
+float s_lift_ctrl_output(float duty) {
+    if(!_cfg) return 0;
+    _duty = duty;
+    return _actuate();
+}
+
+/**
+ * @brief   是否已到位 (在误差带内保持足够时间)
+ * @param   None
+ * @retval  bool true:已到位
+ */
+bool s_lift_ctrl_settled(void) {
+    return _cfg && _in_band_s >= _cfg->settle_hold_s;
+}
+
+/**
+ * @brief   获取最近一次 PID 输出
+ * @param   None
+ * @retval  float 占空比 (-1 ~ 1)
+ */
+float s_lift_ctrl_duty(void) {
+    return _duty;
+}
+
+/**
+ * @brief   获取本次定位统计
+ * @param   out 输出
+ * @retval  None
+ */
+void s_lift_ctrl_stats(lift_ctrl_stats_t* out) {
+    out->settle_s = s_lift_ctrl_settled() ? _settle_s : _elapsed_s;
+    out->overshoot_mm = _overshoot;
+    out->rms_err_mm = _samples ? sqrtf(_err_sq_sum / (float)_samples) : 0.0f;
+    out->final_err_mm = _last_err;
+}
+
+/**
+ * @brief   设置位置 PID 增益 (在线调参, 不清除积分; 增量式下输出不跳变)
+ * @param   kp 比例系数
+ * @param   ki 积分系数
+ * @param   kd 微分系数
+ * @retval  None
+ * @note    串级时位置环输出为速度指令, 增益单位与单环不同
+ */
+void s_lift_ctrl_set_gains(float kp, float ki, float kd) {
+    _pid.set_gains(&_pid, kp, ki, kd);
+}
+
+/**
+ * @brief   设置速度 PID 增益 (仅串级)
+ * @param   kp 比例系数
+ * @param   ki 积分系数
+ * @param   kd 微分系数
+ * @retval  None
+ */
+void s_lift_ctrl_set_vel_gains(float kp, float ki, float kd) {
+    if(_cascade) _vel_pid.set_gains(&_vel_pid, kp, ki, kd);
+}
+
+/**
+ * @brief   是否为串级控制
+ * @param   None
+ * @retval  bool true:串级
+ */
+bool s_lift_ctrl_cascade(void) {
+    return _cascade;
+}
+
+/**
+ * @brief   获取位置环输出的速度指令
+ * @param   None
+ * @retval  float 速度指令 (mm/s), 单环时为 0
+ */
+float s_lift_ctrl_vel_cmd(void) {
+    return _cascade ? _vel_cmd : 0.0f;
+}
+
+// ! ========================= 私 有 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   以新目标重新开始统计
+ * @param   target_mm 目标位置
+ * @param   pos_mm 当前位置
+ * @retval  None
+ */
+static void _restart_stats(float target_mm, float pos_mm) {
+    _target = target_mm;
+    _elapsed_s = 0.0f;
+    _settle_s = 0.0f;
+    _in_band_s = 0.0f;
+    _start_sign = (target_mm >= pos_mm) ? 1.0f : -1.0f;
+    _overshoot = 0.0f;
+    _err_sq_sum = 0.0f;
+    _samples = 0;
+    _last_err = target_mm - pos_mm;
+}
+
+/**
+ * @brief   设置位置 PID 前馈
+ * @param   ff 前馈值 (单环: 占空比; 串级: 速度 mm/s)
+ * @retval  None
+ */
+static void _set_feedforward(float ff) {
+#if LIFT_CTRL_PID_Q16
+    _pid.set_feedforward(&_pid, q16_from_float(ff));
+#else
+    _pid.set_feedforward(&_pid, ff);
+#endif
+}
+
+/**
+ * @brief   驱动前馈 (占空比)
+ * @param   vel_mm_s 速度 (单环为参考速度, 串级为速度指令)
+ * @param   acc_mm_s2 参考加速度
+ * @param   speed_mm_s 实测速度
+ * @retval  float 前馈模型启用时按模型计算, 否则为 vel · vff_s_mm
+ */
+static float _duty_ff(float vel_mm_s, float acc_mm_s2, float speed_mm_s) {
+    if(s_lift_ff_enabled()) return s_lift_ff_eval(vel_mm_s, acc_mm_s2, speed_mm_s);
+    return vel_mm_s * _cfg->vff_s_mm;
+}
+
+/**
+ * @brief   计算一次位置 PID
+ * @param   ref_mm 参考位置
+ * @param   pos_mm 当前位置
+ * @param   dt_s 时间间隔
+ * @retval  float 位置 PID 输出
+ */
+static float _outer_calc(float ref_mm, float pos_mm, float dt_s) {
+#if LIFT_CTRL_PID_Q16
+    (void)dt_s;
+    return q16_to_float(_pid.calculate(&_pid, q16_from_float(ref_mm), q16_from_float(pos_mm)));
+#else
+    return _pid.calculate(&_pid, ref_mm, pos_mm, dt_s);
+#endif
+}
+
+/**
+ * @brief   串级控制一个周期
+ * @param   ref_mm 参考位置
+ * @param   ref_vel_mm_s 参考速度 (位置环前馈)
+ * @param   ref_acc_mm_s2 参考加速度 (速度环前馈模型惯性项)
+ * @param   pos_mm 当前位置
+ * @param   speed_mm_s 当前速度
+ * @param   dt_s 距上次调用的实际时间
+ * @retval  float 占空比
+ */
+static float _cascade_update(float ref_mm, float ref_vel_mm_s, float ref_acc_mm_s2, float pos_mm, float speed_mm_s,
+    float dt_s) {
+    /* 位置环: 分频计算, dt 取累计时间 */
+    _outer_dt += dt_s;
+    if(++_outer_tick >= _cfg->outer_div) {
+        _outer_tick = 0;
+        _set_feedforward(ref_vel_mm_s);
+#if LIFT_CTRL_PID_Q16
+        q16_t held = _pid.integral_;
+#else
+        float held = _pid.integral_;
+#endif
+        _vel_cmd = _outer_calc(ref_mm, pos_mm, _outer_dt);
+        /* 抗饱和协调: 速度环已饱和, 位置误差仍要求同向时冻结位置环积分 */
+        if(_vel_sat != 0 && (ref_mm - pos_mm) * (float)_vel_sat > 0.0f) {
+            _pid.integral_ = held;
+        }
+        _outer_dt = 0.0f;
+    }
+
+    /* 速度环: 每周期计算, 速度指令按满速比例 (或前馈模型) 前馈 */
+    _vel_pid.set_feedforward(&_vel_pid, _duty_ff(_vel_cmd, ref_acc_mm_s2, speed_mm_s));
+    float u = _vel_pid.calculate(&_vel_pid, _vel_cmd, speed_mm_s, dt_s);
+
+    float lim = _vel_pid.max_out_;
+    float dv = _vel_cmd - speed_mm_s;
+    if(u >= lim && dv > 0.0f) _vel_sat = 1;
+    else if(u <= -lim && dv < 0.0f) _vel_sat = -1;
+    else _vel_sat = 0;
+
+    return u;
+}
+
+/**
+ * @brief   时间比例输出
+ * @param   None
+ * @retval  float 本周期驱动指令
+ */
+static float _actuate(void) {
+    if(_cfg->window_ticks == 0) return _duty;
+
+    float mag = fabsf(_duty);
+    if(mag > 1.0f) mag = 1.0f;
+
+    uint8_t want = (uint8_t)(mag * (float)_cfg->window_ticks + 0.5f);
+    if(want < _cfg->min_on_ticks) want = 0;
+    int8_t dir = _duty > 0.0f ? 1 : -1;
+
+    if(_tick == 0) {
+        _on_ticks = want;
+        _dir = dir;
+    }
+    else if(dir != _dir) {
+        /* 窗口内反向: 立即停止, 到下一窗口再换向 */
+        _on_ticks = 0;
+    }
+    else if(want < _on_ticks) {
+        /* 窗口内只允许缩短接通时间 (提前断开), 不重新接通 */
+        _on_ticks = want;
+    }
+
+    dir = (_tick < _on_ticks) ? _dir : 0;
+
+    if(++_tick >= _cfg->window_ticks) _tick = 0;
+    return (float)dir;
+}
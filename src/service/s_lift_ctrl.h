@@ -0,0 +1,86 @@
+/**
+ * @file    s_lift_ctrl.h
+ * @brief   升降台位置闭环控制服务
+ * @note    每个控制周期以实测 dt 计算一次 PID, 输出为占空比 u ∈ [-1, 1];
+ *          继电器只有开/关, 按时间比例方式输出:
+ *
+ *          |<------------- window_ticks ------------->|
+ *          |<-- round(|u| · window) -->|              |
+ *          |        sign(u) 方向驱动   |     停止     |
+ *
+ *          每个窗口开始时锁存一次占空比, 窗口内最多切换一次, 避免继电器抖动;
+ *          接通时间短于 min_on_ticks 的脉冲舍去 (继电器吸合时间内无效).
+ *          window_ticks 为 0 时 (PWM 驱动) 直接输出占空比.
+ *          PID 跟踪轨迹规划给出的参考位置, 调节时间与超调按最终目标统计,
+ *          误差均方根按跟踪误差 (参考 - 实测) 统计, 供调参使用.
+ *          参考速度经 vff_s_mm 换算为占空比作为速度前馈 (PID 配置需含 PID_FEAT_FEEDFORWARD),
+ *          PID 只需补偿跟踪误差; 前馈模型 (s_lift_ff) 启用时改为按参考速度、加速度计算
+ *          重力 + 摩擦 + 惯性前馈
+ *
+ *          -------- 串级 (初始化时给出速度环配置) --------
+ *
+ *          ref_vel ──────────────┐ 前馈           ┌─ × vff_s_mm 前馈 (或前馈模型)
+ *          ref_pos ─→ 位置环 ─→ (+) ─→ v_cmd ─→ 速度环 ─→ 占空比
+ *                      ↑  每 outer_div 周期        ↑ 每周期
+ *                     pos                        speed (编码器)
+ *
+ *          位置环输出速度指令 (mm/s, 限幅即允许的最大速度), 速度环每个控制周期按编码器速度闭环,
+ *          负载突变等扰动由速度环在位置误差出现之前消除.
+ *          抗饱和协调: 速度环输出饱和且仍要求同向加速时, 冻结位置环积分 (位置环应为位置式),
+ *          位置环不再按达不到的速度指令累积; 速度环自身的积分由其抗饱和特性处理
+ */
+#ifndef _s_lift_ctrl_h_
+#define _s_lift_ctrl_h_
+
+#include "s_pid.h"
+#include "s_pid_q16.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// ! ========================= 接 口 变 量 / Typedef 声 明 ========================= ! //
+
+// PID 实现: 1 = Q16.16 定点 (按 period_s 固定周期计算), 0 = 浮点 (按实测 dt 计算)
+#ifndef LIFT_CTRL_PID_Q16
+#define LIFT_CTRL_PID_Q16   0
+#endif
+
+/**
+ * @brief 控制参数
+ */
+typedef struct {
+    uint8_t window_ticks;           // 时间比例窗口长度 (周期数), 0 = 直接输出占空比
+    uint8_t min_on_ticks;           // 最短接通时间 (周期数)
+    float period_s;                 // 名义控制周期 (定点 PID 据此预计算 ki·dt, kd/dt)
+    float vff_s_mm;                 // 速度前馈系数: 参考速度 (mm/s) -> 占空比, 约为 1 / 满占空比速度
+    uint8_t outer_div;              // 串级: 位置环每 outer_div 个周期计算一次 (0 视为 1)
+    float settle_band_mm;           // 到位判定误差带
+    float settle_hold_s;            // 在误差带内保持该时间视为到位
+} lift_ctrl_cfg_t;
+
+/**
+ * @brief 一次定位的统计
+ */
+typedef struct {
+    float settle_s;                 // 调节时间: 开始到最后一次进入误差带 (未到位时为已用时间)
+    float overshoot_mm;             // 越过目标的最大距离
+    float rms_err_mm;               // 跟踪误差均方根
+    float final_err_mm;             // 当前误差
+} lift_ctrl_stats_t;
+
+// ! ========================= 接 口 函 数 声 明 ========================= ! //
+
+void s_lift_ctrl_init(const lift_ctrl_cfg_t* cfg, const pid_cfg_t* pid_cfg, const pid_cfg_t* vel_pid_cfg);
+void s_lift_ctrl_start(float target_mm, float pos_mm, float speed_mm_s, float ref_vel_mm_s, float u0);
+float s_lift_ctrl_update(float target_mm, float ref_mm, float ref_vel_mm_s, float ref_acc_mm_s2, float pos_mm, float speed_mm_s,
+    float dt_s);
+float s_lift_ctrl_output(float duty);
+bool s_lift_ctrl_settled(void);
+float s_lift_ctrl_duty(void);
+void s_lift_ctrl_stats(lift_ctrl_stats_t* out);
+void s_lift_ctrl_set_gains(float kp, float ki, float kd);
+void s_lift_ctrl_set_vel_gains(float kp, float ki, float kd);
+bool s_lift_ctrl_cascade(void);
+float s_lift_ctrl_vel_cmd(void);
+
+#endif
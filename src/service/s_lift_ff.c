@@ -0,0 +1,359 @@
+/**
+ * @file    s_lift_ff.c
+ * @brief   升降台前馈模型服务实现
+ */
+#include "s_lift_ff.h"
+
+#include <math.h>
+
+// ! ========================= 变 量 声 明 ========================= ! //
+
+// 试验段: 0 上行起步, 1 下行起步, 之后每个速度依次上行、下行
+#define LIFT_FF_STEP_RUN        2u
+#define LIFT_FF_STEPS           (LIFT_FF_STEP_RUN + 2u * LIFT_FF_SPEEDS)
+
+static const lift_ff_cfg_t* _cfg = 0;
+static lift_ff_model_t _model;
+static bool _model_valid = false;
+static bool _enabled = false;
+
+/* 辨识 */
+static LiftFfIdentStatus_e _status = LiftFfIdentIdle;
+static LiftFfErr_e _error = LiftFfErrNone;
+static float _tau_s;                // 惯性项使用的时间常数
+static uint8_t _step;               // 当前试验段
+static bool _still;                 // 段间静止等待
+static float _t;                    // 本段已用时间
+static float _p0;                   // 本段起点
+static float _integral;             // 匀速段速度 PI 积分
+static float _y_meas;               // 匀速平均段起点位移 (<0 未开始)
+static float _u_sum;                // 匀速平均段占空比积分
+static float _t_sum;                // 匀速平均段时间
+static bool _sat;                   // 匀速平均段出现饱和
+
+static float _break_u[2];           // 起步占空比 B_dir
+static float _run_v[2][LIFT_FF_SPEEDS];     // 各段平均速度 |v|
+static float _run_u[2][LIFT_FF_SPEEDS];     // 各段平均占空比 |u|
+static lift_ff_model_t _result;
+
+// ! ========================= 私 有 函 数 声 明 ========================= ! //
+
+static void _begin_step(float pos_mm);
+static void _next_step(void);
+static void _finish(void);
+static bool _fit_line(const float* v, const float* u, float* c, float* b);
+static void _fail(LiftFfErr_e err);
+
+// ! ========================= 接 口 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   初始化前馈模型 (未设置模型前不启用)
+ * @param   cfg 前馈与辨识参数
+ * @retval  None
+ */
+void s_lift_ff_init(const lift_ff_cfg_t* cfg) {
+    _cfg = cfg;
+    _model_valid = false;
+    _enabled = false;
+    _status = LiftFfIdentIdle;
+}
+
+/**
+ * @brief   设置模型 (辨识结果或 Flash 中保存的模型), 设置成功后启用
+ * @param   model 模型
+ * @retval  bool true:成功, false:参数无效
+ */
+bool s_lift_ff_set_model(const lift_ff_model_t* model) {
+    if(!_cfg || model->coulomb < 0.0f || model->inertia < 0.0f) return false;
+    for(uint8_t d = 0; d < 2; ++d) {
+        if(!(model->viscous[d] > 0.0f) || model->breakaway[d] < 0.0f) return false;
+    }
+    _model = *model;
+    _model_valid = true;
+    _enabled = true;
+    return true;
+}
+
+/**
+ * @brief   获取当前模型
+ * @param   None
+ * @retval  const lift_ff_model_t* 模型, 未设置时为 0
+ */
+const lift_ff_model_t* s_lift_ff_model(void) {
+    return _model_valid ? &_model : 0;
+}
+
+/**
+ * @brief   启用 / 停用前馈模型 (无模型时不能启用)
+ * @param   enable true:启用
+ * @retval  None
+ */
+void s_lift_ff_enable(bool enable) {
+    _enabled = enable && _model_valid;
+}
+
+/**
+ * @brief   前馈模型是否启用
+ * @param   None
+ * @retval  bool true:启用
+ */
+bool s_lift_ff_enabled(void) {
+    return _enabled;
+}
+
+/**
+ * @brief   计算前馈 (每个控制周期调用一次)
+ * @param   vel_mm_s 参考速度
+ * @param   acc_mm_s2 参考加速度
+ * @param   speed_mm_s 实测速度 (判断是否已起步)
+ * @retval  float 前馈占空比; 未启用时为 0, 参考速度为 0 时为重力偏置
+ */
+float s_lift_ff_eval(float vel_mm_s, float acc_mm_s2, float speed_mm_s) {
+    if(!_enabled) return 0.0f;
+    if(vel_mm_s == 0.0f) return _model.gravity;
+
+    uint8_t d = (vel_mm_s > 0.0f) ? 0 : 1;
+    float sign = (vel_mm_s > 0.0f) ? 1.0f : -1.0f;
+    float fric = (speed_mm_s * sign < _cfg->still_mm_s) ? _model.breakaway[d] : _model.coulomb;
+    float offset = sign * fric;
+    if(fabsf(vel_mm_s) < _cfg->blend_mm_s) offset *= fabsf(vel_mm_s) / _cfg->blend_mm_s;
+
+    return _model.gravity + offset + _model.viscous[d] * vel_mm_s + _model.inertia * acc_mm_s2;
+}
+
+/**
+ * @brief   开始辨识 (平台应静止, 先上行)
+ * @param   pos_mm 当前位置
+ * @param   max_mm 行程上限 (上方不足 travel_mm 时直接失败)
+ * @param   tau_s 一阶惯性时间常数 (惯性项 = τ · 粘性), 未知时为 0
+ * @retval  None
+ */
+void s_lift_ff_ident_start(float pos_mm, float max_mm, float tau_s) {
+    if(!_cfg) return;
+    _status = LiftFfIdentRunning;
+    _error = LiftFfErrNone;
+    _tau_s = (tau_s > 0.0f) ? tau_s : 0.0f;
+    _step = 0;
+    _still = false;
+    _begin_step(pos_mm);
+    if(pos_mm + _cfg->travel_mm > max_mm) _fail(LiftFfErrRange);
+}
+
+/**
+ * @brief   辨识周期处理 (每个控制周期调用一次)
+ * @param   pos_mm 当前位置
+ * @param   speed_mm_s 当前速度 (匀速段速度 PI 反馈)
+ * @param   dt_s 距上次调用的时间
+ * @retval  float 占空比指令 (经时间比例输出); 非运行状态为 0
+ */
+float s_lift_ff_ident_update(float pos_mm, float speed_mm_s, float dt_s) {
+    if(_status != LiftFfIdentRunning) return 0.0f;
+
+    _t += dt_s;
+
+    if(_still) {
+        if(_t >= _cfg->still_s) {
+            _still = false;
+            _begin_step(pos_mm);
+        }
+        return 0.0f;
+    }
+
+    uint8_t d = _step & 1u;
+    float sign = d ? -1.0f : 1.0f;
+    float y = (pos_mm - _p0) * sign;
+    if(fabsf(y) > _cfg->travel_mm) {
+        _fail(LiftFfErrRange);
+        return 0.0f;
+    }
+
+    /* 起步: 占空比按斜率增大直到移动 */
+    if(_step < LIFT_FF_STEP_RUN) {
+        float u = _cfg->ramp_per_s * _t;
+        if(y >= _cfg->move_mm) {
+            _break_u[d] = u;
+            _next_step();
+            return 0.0f;
+        }
+        if(u >= 1.0f) {
+            _fail(LiftFfErrNoMove);
+            return 0.0f;
+        }
+        return sign * u;
+    }
+
+    /* 匀速: 速度 PI, 后段求平均 */
+    uint8_t k = (uint8_t)((_step - LIFT_FF_STEP_RUN) / 2u);
+    float vt = _cfg->speed_mm_s[k];
+    float e = vt - speed_mm_s * sign;
+    _integral += _cfg->ki * e * dt_s;
+    float u = vt * _cfg->u0_s_mm + _integral + _cfg->kp * e;
+    if(u > 1.0f) {
+        u = 1.0f;
+        _integral -= _cfg->ki * e * dt_s;
+    }
+    if(u < 0.0f) {
+        u = 0.0f;
+        _integral -= _cfg->ki * e * dt_s;
+    }
+
+    if(_t >= _cfg->settle_s) {
+        if(_y_meas < 0.0f) {
+            _y_meas = y;
+        }
+        else {
+            _u_sum += u * dt_s;
+            _t_sum += dt_s;
+            if(u >= 1.0f) _sat = true;
+        }
+    }
+
+    if(_t >= _cfg->settle_s + _cfg->measure_s && _t_sum > 0.0f) {
+        if(_sat) {
+            _fail(LiftFfErrSat);
+            return 0.0f;
+        }
+        _run_v[d][k] = (y - _y_meas) / _t_sum;
+        _run_u[d][k] = _u_sum / _t_sum;
+        _next_step();
+        return 0.0f;
+    }
+
+    return sign * u;
+}
+
+/**
+ * @brief   中断辨识
+ * @param   None
+ * @retval  None
+ */
+void s_lift_ff_ident_abort(void) {
+    if(_status == LiftFfIdentRunning) _fail(LiftFfErrAborted);
+}
+
+/**
+ * @brief   获取辨识状态
+ * @param   None
+ * @retval  LiftFfIdentStatus_e 状态
+ */
+LiftFfIdentStatus_e s_lift_ff_ident_status(void) {
+    return _status;
+}
+
+/**
+ * @brief   获取辨识失败原因
+ * @param   None
+ * @retval  LiftFfErr_e 错误码
+ */
+LiftFfErr_e s_lift_ff_ident_error(void) {
+    return _error;
+}
+
+/**
+ * @brief   获取辨识结果
+ * @param   out 模型输出
+ * @retval  bool true:成功
+ */
+bool s_lift_ff_ident_result(lift_ff_model_t* out) {
+    if(_status != LiftFfIdentDone) return false;
+    *out = _result;
+    return true;
+}
+
+// ! ========================= 私 有 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   开始一个试验段
+ * @param   pos_mm 起点位置
+ * @retval  None
+ */
+static void _begin_step(float pos_mm) {
+    _t = 0.0f;
+    _p0 = pos_mm;
+    _integral = 0.0f;
+    _y_meas = -1.0f;
+    _u_sum = 0.0f;
+    _t_sum = 0.0f;
+    _sat = false;
+}
+
+/**
+ * @brief   进入段间等待, 最后一段结束后计算模型
+ * @param   None
+ * @retval  None
+ */
+static void _next_step(void) {
+    if(++_step >= LIFT_FF_STEPS) {
+        _finish();
+        return;
+    }
+    _still = true;
+    _t = 0.0f;
+}
+
+/**
+ * @brief   由各段结果计算模型
+ * @param   None
+ * @retval  None
+ */
+static void _finish(void) {
+    float c[2], b[2];
+    for(uint8_t d = 0; d < 2; ++d) {
+        if(!_fit_line(_run_v[d], _run_u[d], &c[d], &b[d]) || !(b[d] > 0.0f)) {
+            _fail(LiftFfErrFit);
+            return;
+        }
+    }
+
+    _result.gravity = 0.5f * (c[0] - c[1]);
+    _result.coulomb = 0.5f * (c[0] + c[1]);
+    if(_result.coulomb < 0.0f) {
+        _fail(LiftFfErrFit);
+        return;
+    }
+
+    /* 起步值低于库仑摩擦 (无明显静摩擦或斜坡过快) 时取库仑摩擦 */
+    _result.breakaway[0] = _break_u[0] - _result.gravity;
+    _result.breakaway[1] = _break_u[1] + _result.gravity;
+    for(uint8_t d = 0; d < 2; ++d) {
+        if(_result.breakaway[d] < _result.coulomb) _result.breakaway[d] = _result.coulomb;
+        _result.viscous[d] = b[d];
+    }
+    _result.inertia = _tau_s * 0.5f * (b[0] + b[1]);
+
+    _status = LiftFfIdentDone;
+}
+
+/**
+ * @brief   最小二乘拟合 u = c + b·v
+ * @param   v 速度
+ * @param   u 占空比
+ * @param   c 截距输出
+ * @param   b 斜率输出
+ * @retval  bool true:成功, false:速度档重合
+ */
+static bool _fit_line(const float* v, const float* u, float* c, float* b) {
+    float n = (float)LIFT_FF_SPEEDS;
+    float sv = 0.0f, su = 0.0f, svv = 0.0f, svu = 0.0f;
+    for(uint8_t k = 0; k < LIFT_FF_SPEEDS; ++k) {
+        sv += v[k];
+        su += u[k];
+        svv += v[k] * v[k];
+        svu += v[k] * u[k];
+    }
+    float den = n * svv - sv * sv;
+    if(den <= 0.0f) return false;
+    *b = (n * svu - sv * su) / den;
+    *c = (su - *b * sv) / n;
+    return true;
+}
+
+/**
+ * @brief   辨识失败
+ * @param   err 错误码
+ * @retval  None
+ */
+static void _fail(LiftFfErr_e err) {
+    _status = LiftFfIdentFailed;
+    _error = err;
+}
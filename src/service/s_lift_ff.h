@@ -0,0 +1,98 @@
+/**
+ * @file    s_lift_ff.h
+ * @brief   升降台前馈模型服务 (重力 + 摩擦 + 惯性, 匀速试验辨识)
+ * @note    按轨迹参考速度 v、加速度 a 给出维持该运动所需的驱动 (占空比), PID 只补偿剩余误差:
+ *
+ *              u_ff = g + sgn(v)·F + b_dir·v + m·a
+ *
+ *          - g: 重力偏置, 两个方向相同 (上行需克服, 下行被其带动)
+ *          - F: 实测速度为 0 (或与 v 反向) 时取起步静摩擦 Fs_dir, 运动后取库仑摩擦 Fc
+ *          - b_dir: 粘性摩擦, 按方向分别辨识 (含驱动非线性的差异)
+ *          - m: 惯性项, 由一阶惯性时间常数换算 m = τ · b (阶跃辨识有模型时取其 τ)
+ *          g 始终输出 (参考速度为 0 时只剩 g): 轨迹结束后最后的修正仍有重力补偿, 不必等积分重新建立;
+ *          |v| 低于 blend_mm_s 时 F 按比例减小, 轨迹起止及速度过零时前馈连续, 不会出现整个静摩擦幅度的跳变.
+ *
+ *          辨识 (静止开始, 上下交替, 平台大致回到起点):
+ *          1. 起步: 每个方向占空比从 0 按斜率增大, 移动超过 move_mm 时的占空比为起步值 B_dir
+ *          2. 匀速: 每个速度先上行再下行, 速度 PI 控制进入匀速, 后段按位置求平均速度, 同时求平均占空比
+ *          3. 每个方向最小二乘拟合 |u| = c_dir + b_dir·|v|, 则
+ *                 c_up = g + Fc,  c_dn = Fc - g  →  g = (c_up - c_dn) / 2,  Fc = (c_up + c_dn) / 2
+ *                 Fs_up = B_up - g,  Fs_dn = B_dn + g
+ *             匀速试验只能分出两个方向常数项的和与差, 库仑摩擦按两方向对称处理,
+ *             方向差异由 b_dir 与 Fs_dir 体现.
+ *          占空比为时间比例前的指令值, 继电器最短接通, 吸合损失等均折算在模型中,
+ *          与定位时前馈所经过的输出环节一致
+ */
+#ifndef _s_lift_ff_h_
+#define _s_lift_ff_h_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// ! ========================= 接 口 变 量 / Typedef 声 明 ========================= ! //
+
+// 匀速试验的速度档数
+#define LIFT_FF_SPEEDS          3u
+
+/**
+ * @brief 前馈模型 (单位均为占空比)
+ */
+typedef struct {
+    float gravity;                  // 重力偏置 (正为需要向上驱动)
+    float coulomb;                  // 库仑摩擦 (运动中, 两方向对称)
+    float breakaway[2];             // 起步静摩擦 (不含重力), [0] 上行, [1] 下行
+    float viscous[2];               // 粘性摩擦 (每 mm/s), [0] 上行, [1] 下行
+    float inertia;                  // 惯性 (每 mm/s^2)
+} lift_ff_model_t;
+
+/**
+ * @brief 前馈与辨识参数
+ */
+typedef struct {
+    float still_mm_s;               // 实测速度低于该值视为静止 (前馈取起步静摩擦)
+    float blend_mm_s;               // 参考速度低于该值时摩擦项按比例减小
+    float speed_mm_s[LIFT_FF_SPEEDS];   // 匀速试验速度 (应在时间比例输出可达范围内)
+    float settle_s;                 // 每段进入匀速的时间 (不计入平均)
+    float measure_s;                // 匀速平均时间
+    float still_s;                  // 两段之间的静止等待时间
+    float travel_mm;                // 单段最大行程 (起点上方应留出该行程)
+    float ramp_per_s;               // 起步试验占空比斜率 (越慢, 纯滞后引起的偏大越小)
+    float move_mm;                  // 起步判定距离
+    float u0_s_mm;                  // 匀速段初始占空比: 速度 × u0_s_mm (约 1 / 满占空比速度)
+    float kp;                       // 匀速段速度 PI (占空比 / (mm/s))
+    float ki;
+} lift_ff_cfg_t;
+
+typedef enum {
+    LiftFfIdentIdle = 0,
+    LiftFfIdentRunning,
+    LiftFfIdentDone,
+    LiftFfIdentFailed
+} LiftFfIdentStatus_e;
+
+typedef enum {
+    LiftFfErrNone = 0,
+    LiftFfErrNoMove,                // 起步试验占空比升到 1 仍未移动
+    LiftFfErrSat,                   // 匀速段占空比饱和, 速度不可达
+    LiftFfErrFit,                   // 粘性或库仑摩擦为负
+    LiftFfErrRange,                 // 行程不足或单段超出 travel_mm
+    LiftFfErrAborted                // 被停止命令中断
+} LiftFfErr_e;
+
+// ! ========================= 接 口 函 数 声 明 ========================= ! //
+
+void s_lift_ff_init(const lift_ff_cfg_t* cfg);
+bool s_lift_ff_set_model(const lift_ff_model_t* model);
+const lift_ff_model_t* s_lift_ff_model(void);
+void s_lift_ff_enable(bool enable);
+bool s_lift_ff_enabled(void);
+float s_lift_ff_eval(float vel_mm_s, float acc_mm_s2, float speed_mm_s);
+
+void s_lift_ff_ident_start(float pos_mm, float max_mm, float tau_s);
+float s_lift_ff_ident_update(float pos_mm, float speed_mm_s, float dt_s);
+void s_lift_ff_ident_abort(void);
+LiftFfIdentStatus_e s_lift_ff_ident_status(void);
+LiftFfErr_e s_lift_ff_ident_error(void);
+bool s_lift_ff_ident_result(lift_ff_model_t* out);
+
+#endif
@@ -0,0 +1,222 @@
+/**
+ * @file    s_lift_gains.c
+ * @brief   升降台位置 PID 增益调度服务实现
+ */
+#include "s_lift_gains.h"
+
+// ! ========================= 变 量 声 明 ========================= ! //
+
+static const lift_gains_cfg_t* _cfg = 0;
+static lift_gain_table_t* _table = 0;
+static bool _enabled = false;
+
+static lift_gains_t _base;          // 基准增益 (未启用时使用)
+static lift_gains_t _gains;         // 当前 (过渡中的) 增益
+static LiftLoad_e _load = LiftLoadEmpty;
+static int8_t _dir = 1;             // 当前方向
+
+// ! ========================= 私 有 函 数 声 明 ========================= ! //
+
+static uint8_t _dir_index(int8_t dir);
+
+// ! ========================= 接 口 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   初始化增益调度
+ * @param   cfg 调度参数
+ * @param   table 增益表 (参数区中的存储位置)
+ * @param   enable 表是否有效 (已从 Flash 加载)
+ * @retval  None
+ */
+void s_lift_gains_init(const lift_gains_cfg_t* cfg, lift_gain_table_t* table, bool enable) {
+    _cfg = cfg;
+    _table = table;
+    _enabled = enable;
+}
+
+/**
+ * @brief   设置基准增益 (配置表或自整定结果)
+ * @param   base 增益
+ * @retval  None
+ */
+void s_lift_gains_set_base(const lift_gains_t* base) {
+    _base = *base;
+    if(!_enabled) _gains = *base;
+}
+
+/**
+ * @brief   启用调度 (已启用时无动作)
+ * @param   min_mm 行程下限 (断点默认均布在行程内)
+ * @param   max_mm 行程上限
+ * @retval  None
+ * @note    首次启用时整张表填为基准增益, 此后逐项修改
+ */
+void s_lift_gains_enable(float min_mm, float max_mm) {
+    if(!_table || _enabled) return;
+
+    for(uint8_t i = 0; i < LIFT_GAINS_POINTS; ++i) {
+        _table->pos_mm[i] = min_mm + (max_mm - min_mm) * (float)i / (float)(LIFT_GAINS_POINTS - 1);
+        for(uint8_t d = 0; d < 2; ++d) {
+            for(uint8_t l = 0; l < LiftLoadCount; ++l) {
+                _table->gains[d][l][i] = _base;
+            }
+        }
+    }
+    _enabled = true;
+}
+
+/**
+ * @brief   停用调度 (回到基准增益, 表内容保留在 RAM 中)
+ * @param   None
+ * @retval  None
+ */
+void s_lift_gains_disable(void) {
+    _enabled = false;
+    _gains = _base;
+}
+
+/**
+ * @brief   调度是否启用
+ * @param   None
+ * @retval  bool true:启用
+ */
+bool s_lift_gains_enabled(void) {
+    return _enabled;
+}
+
+/**
+ * @brief   修改表项
+ * @param   dir 方向: 1 上行, -1 下行
+ * @param   load 负载状态
+ * @param   idx 断点序号
+ * @param   g 增益
+ * @retval  bool true:成功, false:未启用或序号无效
+ */
+bool s_lift_gains_set(int8_t dir, LiftLoad_e load, uint8_t idx, const lift_gains_t* g) {
+    if(!_enabled || load >= LiftLoadCount || idx >= LIFT_GAINS_POINTS) return false;
+    _table->gains[_dir_index(dir)][load][idx] = *g;
+    return true;
+}
+
+/**
+ * @brief   修改位置断点
+ * @param   pos_mm LIFT_GAINS_POINTS 个断点
+ * @retval  bool true:成功, false:未启用或断点不递增
+ */
+bool s_lift_gains_set_points(const float* pos_mm) {
+    if(!_enabled) return false;
+    for(uint8_t i = 1; i < LIFT_GAINS_POINTS; ++i) {
+        if(!(pos_mm[i] > pos_mm[i - 1])) return false;
+    }
+    for(uint8_t i = 0; i < LIFT_GAINS_POINTS; ++i) {
+        _table->pos_mm[i] = pos_mm[i];
+    }
+    return true;
+}
+
+/**
+ * @brief   设置负载状态
+ * @param   load 负载状态
+ * @retval  None
+ */
+void s_lift_gains_set_load(LiftLoad_e load) {
+    if(load < LiftLoadCount) _load = load;
+}
+
+/**
+ * @brief   获取负载状态
+ * @param   None
+ * @retval  LiftLoad_e 负载状态
+ */
+LiftLoad_e s_lift_gains_load(void) {
+    return _load;
+}
+
+/**
+ * @brief   查表 (位置线性插值, 不含过渡)
+ * @param   dir 方向: 1 上行, -1 下行
+ * @param   load 负载状态
+ * @param   pos_mm 位置
+ * @param   out 增益输出
+ * @retval  None
+ */
+void s_lift_gains_lookup(int8_t dir, LiftLoad_e load, float pos_mm, lift_gains_t* out) {
+    if(!_enabled || load >= LiftLoadCount) {
+        *out = _base;
+        return;
+    }
+
+    const float* p = _table->pos_mm;
+    const lift_gains_t* g = _table->gains[_dir_index(dir)][load];
+
+    if(pos_mm <= p[0]) {
+        *out = g[0];
+        return;
+    }
+    for(uint8_t i = 1; i < LIFT_GAINS_POINTS; ++i) {
+        if(pos_mm < p[i]) {
+            float t = (pos_mm - p[i - 1]) / (p[i] - p[i - 1]);
+            out->kp = g[i - 1].kp + (g[i].kp - g[i - 1].kp) * t;
+            out->ki = g[i - 1].ki + (g[i].ki - g[i - 1].ki) * t;
+            out->kd = g[i - 1].kd + (g[i].kd - g[i - 1].kd) * t;
+            return;
+        }
+    }
+    *out = g[LIFT_GAINS_POINTS - 1];
+}
+
+/**
+ * @brief   开始一次定位: 按初始方向直接取查表值 (不过渡)
+ * @param   dir 方向: 1 上行, -1 下行
+ * @param   pos_mm 当前位置
+ * @retval  const lift_gains_t* 当前增益
+ */
+const lift_gains_t* s_lift_gains_reset(int8_t dir, float pos_mm) {
+    _dir = (dir >= 0) ? 1 : -1;
+    s_lift_gains_lookup(_dir, _load, pos_mm, &_gains);
+    return &_gains;
+}
+
+/**
+ * @brief   调度周期处理 (每个控制周期调用一次)
+ * @param   ref_vel_mm_s 参考速度 (判定方向)
+ * @param   pos_mm 当前位置
+ * @param   dt_s 控制周期
+ * @retval  const lift_gains_t* 当前增益
+ * @note    位置插值本身连续, 一阶过渡只在方向 / 负载切换或修改表项时起作用
+ */
+const lift_gains_t* s_lift_gains_update(float ref_vel_mm_s, float pos_mm, float dt_s) {
+    if(!_cfg || !_enabled) return &_gains;
+
+    if(ref_vel_mm_s > _cfg->dir_speed_mm_s) _dir = 1;
+    else if(ref_vel_mm_s < -_cfg->dir_speed_mm_s) _dir = -1;
+
+    lift_gains_t want;
+    s_lift_gains_lookup(_dir, _load, pos_mm, &want);
+
+    float a = dt_s / (_cfg->blend_tau_s + dt_s);
+    _gains.kp += (want.kp - _gains.kp) * a;
+    _gains.ki += (want.ki - _gains.ki) * a;
+    _gains.kd += (want.kd - _gains.kd) * a;
+    return &_gains;
+}
+
+/**
+ * @brief   获取增益表 (用于报告)
+ * @param   None
+ * @retval  const lift_gain_table_t* 增益表
+ */
+const lift_gain_table_t* s_lift_gains_table(void) {
+    return _table;
+}
+
+// ! ========================= 私 有 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   方向转换为表下标
+ * @param   dir 方向: 1 上行, -1 下行
+ * @retval  uint8_t 0 上行, 1 下行
+ */
+static uint8_t _dir_index(int8_t dir) {
+    return (dir >= 0) ? 0 : 1;
+}
@@ -0,0 +1,79 @@
+/**
+ * @file    s_lift_gains.h
+ * @brief   升降台位置 PID 增益调度服务
+ * @note    上行 / 下行 (重力) 与空载 / 夹持负载时对象特性不同, 一组增益只能折中.
+ *          增益表按 方向 × 负载 × 位置断点 存放:
+ *
+ *                       pos[0]      pos[1]      pos[2]
+ *          上行 空载    g           g           g
+ *          上行 负载    g           g           g
+ *          下行 空载    g           g           g
+ *          下行 负载    g           g           g
+ *
+ *          位置在断点之间线性插值, 断点外取端点值; 方向取参考速度的符号 (速度为 0 时保持上一方向),
+ *          负载由夹爪开合命令设置. 方向或负载切换时查表结果跳变, 实际增益以 blend_tau_s 一阶过渡.
+ *          增益表存放在参数区 (param_t::gain_table), 修改后经 s_param_save 保存;
+ *          未启用时始终给出基准增益 (配置表或自整定结果), 行为与不调度相同
+ */
+#ifndef _s_lift_gains_h_
+#define _s_lift_gains_h_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// ! ========================= 接 口 变 量 / Typedef 声 明 ========================= ! //
+
+// 每张表的位置断点数
+#define LIFT_GAINS_POINTS   3
+
+/**
+ * @brief 负载状态
+ */
+typedef enum {
+    LiftLoadEmpty = 0,              // 夹爪张开 / 空载
+    LiftLoadHeld,                   // 夹爪闭合 / 夹持负载
+    LiftLoadCount
+} LiftLoad_e;
+
+/**
+ * @brief 一组 PID 增益
+ */
+typedef struct {
+    float kp;
+    float ki;
+    float kd;
+} lift_gains_t;
+
+/**
+ * @brief 增益表 (保存在参数区)
+ */
+typedef struct {
+    float pos_mm[LIFT_GAINS_POINTS];                                // 位置断点 (递增)
+    lift_gains_t gains[2][LiftLoadCount][LIFT_GAINS_POINTS];        // [0 上行 / 1 下行][负载][断点]
+} lift_gain_table_t;
+
+/**
+ * @brief 调度参数
+ */
+typedef struct {
+    float blend_tau_s;              // 方向 / 负载切换时增益过渡的时间常数
+    float dir_speed_mm_s;           // 参考速度超过该值才判定方向
+} lift_gains_cfg_t;
+
+// ! ========================= 接 口 函 数 声 明 ========================= ! //
+
+void s_lift_gains_init(const lift_gains_cfg_t* cfg, lift_gain_table_t* table, bool enable);
+void s_lift_gains_set_base(const lift_gains_t* base);
+void s_lift_gains_enable(float min_mm, float max_mm);
+void s_lift_gains_disable(void);
+bool s_lift_gains_enabled(void);
+bool s_lift_gains_set(int8_t dir, LiftLoad_e load, uint8_t idx, const lift_gains_t* g);
+bool s_lift_gains_set_points(const float* pos_mm);
+void s_lift_gains_set_load(LiftLoad_e load);
+LiftLoad_e s_lift_gains_load(void);
+void s_lift_gains_lookup(int8_t dir, LiftLoad_e load, float pos_mm, lift_gains_t* out);
+const lift_gains_t* s_lift_gains_reset(int8_t dir, float pos_mm);
+const lift_gains_t* s_lift_gains_update(float ref_vel_mm_s, float pos_mm, float dt_s);
+const lift_gain_table_t* s_lift_gains_table(void);
+
+#endif
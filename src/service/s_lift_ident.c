@@ -0,0 +1,257 @@
+/**
+ * @file    s_lift_ident.c
+ * @brief   升降台对象辨识服务实现
+ */
+#include "s_lift_ident.h"
+
+#include <math.h>
+
+// ! ========================= 变 量 声 明 ========================= ! //
+
+#define LIFT_IDENT_MIN_FIT      5u          // 拟合段最少样本数
+#define LIFT_IDENT_BISECT       24u         // 求 L 的二分次数
+
+/**
+ * @brief   试验阶段
+ */
+typedef enum {
+    IdentUp = 0,                // 上行阶跃
+    IdentStill,                 // 停止等待
+    IdentDown                   // 下行阶跃
+} IdentPhase_e;
+
+static const lift_ident_cfg_t* _cfg = 0;
+static LiftIdentStatus_e _status = LiftIdentIdle;
+static LiftIdentErr_e _error = LiftIdentErrNone;
+static IdentPhase_e _phase = IdentUp;
+
+static float _t;                    // 本阶段已用时间
+static float _p0;                   // 本次阶跃起点
+static float _y_prev;               // 上一周期位移 (按方向取正)
+static float _tm;                   // 首次移动时刻 (<0 未移动)
+
+/* 渐近线最小二乘累加 (t, y) */
+static uint16_t _n;
+static float _st, _sy, _stt, _sty;
+
+static lift_ident_result_t _result;
+
+// ! ========================= 私 有 函 数 声 明 ========================= ! //
+
+static void _begin_step(float pos_mm);
+static bool _finish_step(lift_fopdt_t* out);
+static float _curve(float s, float tm, float dead_s, float tau_s);
+static void _fail(LiftIdentErr_e err);
+
+// ! ========================= 接 口 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   初始化对象辨识
+ * @param   cfg 试验参数
+ * @retval  None
+ */
+void s_lift_ident_init(const lift_ident_cfg_t* cfg) {
+    _cfg = cfg;
+    _status = LiftIdentIdle;
+}
+
+/**
+ * @brief   开始试验 (平台应静止, 先上行后下行)
+ * @param   pos_mm 当前位置
+ * @param   max_mm 行程上限 (上方不足 travel_mm 时直接失败)
+ * @retval  None
+ */
+void s_lift_ident_start(float pos_mm, float max_mm) {
+    if(!_cfg) return;
+    _status = LiftIdentRunning;
+    _error = LiftIdentErrNone;
+    _phase = IdentUp;
+    _begin_step(pos_mm);
+    if(pos_mm + _cfg->travel_mm > max_mm) _fail(LiftIdentErrRange);
+}
+
+/**
+ * @brief   试验周期处理 (每个控制周期调用一次)
+ * @param   pos_mm 当前位置
+ * @param   dt_s 距上次调用的时间
+ * @retval  float 驱动指令 (±amp 或 0); 非运行状态为 0
+ */
+float s_lift_ident_update(float pos_mm, float dt_s) {
+    if(_status != LiftIdentRunning) return 0.0f;
+
+    if(_phase == IdentStill) {
+        _t += dt_s;
+        if(_t < _cfg->still_s) return 0.0f;
+        _phase = IdentDown;
+        _begin_step(pos_mm);
+    }
+
+    /* 阶跃从输出驱动的这一周期起算: 本周期 t = 已驱动时间, 两个方向一致 */
+    float t = _t;
+    _t += dt_s;
+
+    float sign = (_phase == IdentUp) ? 1.0f : -1.0f;
+    float y = (pos_mm - _p0) * sign;
+
+    /* 首次移动: 在相邻两个样本间线性插值 */
+    if(_tm < 0.0f && y >= _cfg->move_mm) {
+        float dy = y - _y_prev;
+        _tm = (t - dt_s) + ((dy > 0.0f) ? (_cfg->move_mm - _y_prev) / dy * dt_s : dt_s);
+    }
+    _y_prev = y;
+
+    if(_tm >= 0.0f && t >= 0.5f * _cfg->run_s) {
+        _n++;
+        _st += t;
+        _sy += y;
+        _stt += t * t;
+        _sty += t * y;
+    }
+
+    if(t < _cfg->run_s && y < _cfg->travel_mm) {
+        return sign * _cfg->amp;
+    }
+
+    /* 本方向结束 */
+    if(!_finish_step(&_result.dir[_phase == IdentUp ? 0 : 1])) return 0.0f;
+
+    if(_phase == IdentUp) {
+        _phase = IdentStill;
+        _t = 0.0f;
+        return 0.0f;
+    }
+
+    _result.model.k_mm_s = 0.5f * (_result.dir[0].k_mm_s + _result.dir[1].k_mm_s);
+    _result.model.tau_s = 0.5f * (_result.dir[0].tau_s + _result.dir[1].tau_s);
+    _result.model.dead_s = 0.5f * (_result.dir[0].dead_s + _result.dir[1].dead_s);
+    _status = LiftIdentDone;
+    return 0.0f;
+}
+
+/**
+ * @brief   中断试验
+ * @param   None
+ * @retval  None
+ */
+void s_lift_ident_abort(void) {
+    if(_status == LiftIdentRunning) _fail(LiftIdentErrAborted);
+}
+
+/**
+ * @brief   获取试验状态
+ * @param   None
+ * @retval  LiftIdentStatus_e 状态
+ */
+LiftIdentStatus_e s_lift_ident_status(void) {
+    return _status;
+}
+
+/**
+ * @brief   获取失败原因
+ * @param   None
+ * @retval  LiftIdentErr_e 错误码
+ */
+LiftIdentErr_e s_lift_ident_error(void) {
+    return _error;
+}
+
+/**
+ * @brief   获取辨识结果
+ * @param   out 结果输出
+ * @retval  bool true:成功
+ */
+bool s_lift_ident_result(lift_ident_result_t* out) {
+    if(_status != LiftIdentDone) return false;
+    *out = _result;
+    return true;
+}
+
+// ! ========================= 私 有 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   开始一个方向的阶跃
+ * @param   pos_mm 起点位置
+ * @retval  None
+ */
+static void _begin_step(float pos_mm) {
+    _t = 0.0f;
+    _p0 = pos_mm;
+    _y_prev = 0.0f;
+    _tm = -1.0f;
+    _n = 0;
+    _st = _sy = _stt = _sty = 0.0f;
+}
+
+/**
+ * @brief   由累加量计算一个方向的模型
+ * @param   out 模型输出
+ * @retval  bool true:成功, false:已置为失败
+ */
+static bool _finish_step(lift_fopdt_t* out) {
+    if(_tm < 0.0f) {
+        _fail(LiftIdentErrNoMove);
+        return false;
+    }
+    if(_n < LIFT_IDENT_MIN_FIT) {
+        _fail(LiftIdentErrShort);
+        return false;
+    }
+
+    float n = (float)_n;
+    float den = n * _stt - _st * _st;
+    if(den <= 0.0f) {
+        _fail(LiftIdentErrShort);
+        return false;
+    }
+
+    float s = (n * _sty - _st * _sy) / den;         // 渐近线斜率 (mm/s)
+    float t0 = (s > 0.0f) ? (_st * s - _sy) / (n * s) : -1.0f;
+    if(s <= 0.0f || t0 <= 0.0f) {
+        _fail(LiftIdentErrFit);
+        return false;
+    }
+
+    /* L ∈ [0, min(tm, t0)], 曲线在 tm 处的位移随 L 增大而减小 */
+    float lo = 0.0f;
+    float hi = (_tm < t0) ? _tm : t0;
+    if(_curve(s, _tm, 0.0f, t0) > _cfg->move_mm) {
+        for(uint8_t i = 0; i < LIFT_IDENT_BISECT; ++i) {
+            float mid = 0.5f * (lo + hi);
+            if(_curve(s, _tm, mid, t0 - mid) > _cfg->move_mm) lo = mid;
+            else hi = mid;
+        }
+    }
+    else {
+        hi = 0.0f;                  // 起步比无滞后的模型还快: 取 L = 0
+    }
+
+    out->k_mm_s = s / _cfg->amp;
+    out->dead_s = 0.5f * (lo + hi);
+    out->tau_s = t0 - out->dead_s;
+    return true;
+}
+
+/**
+ * @brief   模型阶跃响应在 tm 时刻的位移
+ * @param   s 稳态速度 (K·u)
+ * @param   tm 时刻
+ * @param   dead_s 纯滞后
+ * @param   tau_s 时间常数
+ * @retval  float 位移
+ */
+static float _curve(float s, float tm, float dead_s, float tau_s) {
+    float x = tm - dead_s;
+    if(x <= 0.0f) return 0.0f;
+    if(tau_s <= 1e-6f) return s * x;
+    return s * (x - tau_s * (1.0f - expf(-x / tau_s)));
+}
+
+/**
+ * @brief   试验失败
+ * @param   err 错误码
+ * @retval  None
+ */
+static void _fail(LiftIdentErr_e err) {
+    _status = LiftIdentFailed;
+    _error = err;
+}
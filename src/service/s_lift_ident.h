@@ -0,0 +1,87 @@
+/**
+ * @file    s_lift_ident.h
+ * @brief   升降台对象辨识服务 (阶跃试验, 一阶惯性 + 纯滞后 + 积分)
+ * @note    占空比 -> 速度按一阶惯性加纯滞后建模, 位置为速度的积分:
+ *
+ *              v(s) / u(s) = K · e^(-L·s) / (τ·s + 1)
+ *
+ *          静止时先上行再下行各施加一次幅值 u 的阶跃, 按位置计算 (不依赖编码器速度的滤波):
+ *
+ *          位置 ^                       .´
+ *               |                    .´   ← 渐近线 y = K·u·(t - L - τ), 后半程最小二乘拟合
+ *               |                 .´
+ *               |              .´
+ *               |          _.-´
+ *           m   |- - - -.-´
+ *               +------'-+-------------------> t
+ *                      | t0 = L + τ (渐近线与起点的交点)
+ *                      tm: 首次移动超过 m
+ *
+ *          - K: 渐近线斜率 / u
+ *          - L, τ: L + τ = t0; 再由首次移动时刻满足的曲线方程
+ *                  m = K·u·((tm - L) - τ·(1 - e^(-(tm - L)/τ))) 二分求 L
+ *          两个方向的结果取平均作为模型, 差异 (重力) 由使用方的扰动估计补偿
+ */
+#ifndef _s_lift_ident_h_
+#define _s_lift_ident_h_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// ! ========================= 接 口 变 量 / Typedef 声 明 ========================= ! //
+
+/**
+ * @brief 一阶惯性 + 纯滞后模型 (速度)
+ */
+typedef struct {
+    float k_mm_s;                   // 增益: 单位占空比的稳态速度 (mm/s)
+    float tau_s;                    // 惯性时间常数
+    float dead_s;                   // 纯滞后 (继电器吸合 + 克服静摩擦)
+} lift_fopdt_t;
+
+/**
+ * @brief 试验参数
+ */
+typedef struct {
+    float amp;                      // 阶跃幅值 (占空比, 继电器为 1)
+    float run_s;                    // 每个方向的驱动时间
+    float travel_mm;                // 每个方向的最大行程 (先到先停)
+    float move_mm;                  // 首次移动判定距离 (应为数个编码器分辨率)
+    float still_s;                  // 两次阶跃之间的静止等待时间
+} lift_ident_cfg_t;
+
+typedef enum {
+    LiftIdentIdle = 0,
+    LiftIdentRunning,
+    LiftIdentDone,
+    LiftIdentFailed
+} LiftIdentStatus_e;
+
+typedef enum {
+    LiftIdentErrNone = 0,
+    LiftIdentErrNoMove,             // 驱动时间内未移动
+    LiftIdentErrShort,              // 拟合段样本不足 (行程过短)
+    LiftIdentErrFit,                // 斜率方向错误或交点不合理
+    LiftIdentErrRange,              // 上方行程不足一个阶跃
+    LiftIdentErrAborted             // 被停止命令中断
+} LiftIdentErr_e;
+
+/**
+ * @brief 辨识结果
+ */
+typedef struct {
+    lift_fopdt_t model;             // 两个方向的平均
+    lift_fopdt_t dir[2];            // [0] 上行, [1] 下行
+} lift_ident_result_t;
+
+// ! ========================= 接 口 函 数 声 明 ========================= ! //
+
+void s_lift_ident_init(const lift_ident_cfg_t* cfg);
+void s_lift_ident_start(float pos_mm, float max_mm);
+float s_lift_ident_update(float pos_mm, float dt_s);
+void s_lift_ident_abort(void);
+LiftIdentStatus_e s_lift_ident_status(void);
+LiftIdentErr_e s_lift_ident_error(void);
+bool s_lift_ident_result(lift_ident_result_t* out);
+
+#endif
@@ -0,0 +1,163 @@
+/**
+ * @file    s_lift_latency.c
+ * @brief   升降台驱动延迟测量服务实现
+ */
+#include "s_lift_latency.h"
+
+// ! ========================= 变 量 声 明 ========================= ! //
+
+typedef enum {
+    PhaseIdle = 0,
+    PhaseStart,                     // 等待起动后第一个边沿
+    PhaseStop                       // 等待停车后静止
+} Phase_e;
+
+static uint32_t (*_get_cycles)(void) = 0;
+static int64_t (*_read_pulses)(void) = 0;
+static uint32_t _cycles_per_ms = 1;
+
+static int8_t _last_dir = 0;        // 上一次驱动方向
+static Phase_e _phase = PhaseIdle;
+static LiftLatency_e _which;        // 本次测量归属的条目
+static uint32_t _t0;                // 方向改变时刻
+static uint32_t _t_edge;            // 最近一个边沿时刻
+static int64_t _pulses;             // 最近一次读到的计数
+static bool _moved;                 // 停车后是否还出现过边沿
+
+static lift_latency_stat_t _stats[LiftLatencyCount];
+
+// ! ========================= 私 有 函 数 声 明 ========================= ! //
+
+static void _record(LiftLatency_e which, uint32_t cycles);
+
+// ! ========================= 接 口 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   初始化延迟测量
+ * @param   get_cycles CPU 周期计数
+ * @param   read_pulses 读取编码器实时累计脉冲数
+ * @param   cycles_per_ms 每毫秒周期数
+ * @retval  None
+ */
+void s_lift_latency_init(uint32_t (*get_cycles)(void), int64_t (*read_pulses)(void), uint32_t cycles_per_ms) {
+    _get_cycles = get_cycles;
+    _read_pulses = read_pulses;
+    _cycles_per_ms = cycles_per_ms ? cycles_per_ms : 1;
+    s_lift_latency_reset();
+}
+
+/**
+ * @brief   驱动方向已改变 (在实际输出改变后立即调用)
+ * @param   dir 新方向: 1 上行, -1 下行, 0 停止
+ * @retval  None
+ * @note    未完成的测量被放弃; 直接换向 (不经停止) 不测量
+ */
+void s_lift_latency_command(int8_t dir) {
+    if(!_get_cycles) return;
+
+    _phase = PhaseIdle;
+    _t0 = _get_cycles();
+    _t_edge = _t0;
+    _pulses = _read_pulses();
+    _moved = false;
+
+    if(_last_dir == 0 && dir != 0) {
+        _which = (dir > 0) ? LiftLatencyStartUp : LiftLatencyStartDown;
+        _phase = PhaseStart;
+    }
+    else if(_last_dir != 0 && dir == 0) {
+        _which = (_last_dir > 0) ? LiftLatencyStopUp : LiftLatencyStopDown;
+        _phase = PhaseStop;
+    }
+
+    _last_dir = dir;
+}
+
+/**
+ * @brief   轮询编码器 (主循环每次调用)
+ * @param   None
+ * @retval  None
+ */
+void s_lift_latency_poll(void) {
+    if(_phase == PhaseIdle) return;
+
+    uint32_t now = _get_cycles();
+    int64_t pulses = _read_pulses();
+    bool edge = (pulses != _pulses);
+    _pulses = pulses;
+
+    if(_phase == PhaseStart) {
+        if(edge) {
+            _record(_which, now - _t0);
+            _phase = PhaseIdle;
+        }
+        else if(now - _t0 > LIFT_LATENCY_TIMEOUT_MS * _cycles_per_ms) {
+            _phase = PhaseIdle;
+        }
+        return;
+    }
+
+    /* PhaseStop */
+    if(edge) {
+        _t_edge = now;
+        _moved = true;
+    }
+    else if(now - _t_edge > LIFT_LATENCY_STILL_MS * _cycles_per_ms) {
+        if(_moved) _record(_which, _t_edge - _t0);
+        _phase = PhaseIdle;
+    }
+}
+
+/**
+ * @brief   获取统计
+ * @param   which 条目
+ * @param   out 输出
+ * @retval  None
+ */
+void s_lift_latency_get(LiftLatency_e which, lift_latency_stat_t* out) {
+    *out = _stats[which];
+}
+
+/**
+ * @brief   获取位置控制预测超前时间
+ * @param   dir 运动方向: 1 上行, -1 下行
+ * @retval  float 该方向起动延迟均值 (s), 无样本时为 0
+ */
+float s_lift_latency_lead_s(int8_t dir) {
+    const lift_latency_stat_t* st = &_stats[dir > 0 ? LiftLatencyStartUp : LiftLatencyStartDown];
+    return st->count ? st->mean_ms * 0.001f : 0.0f;
+}
+
+/**
+ * @brief   清除全部统计
+ * @param   None
+ * @retval  None
+ */
+void s_lift_latency_reset(void) {
+    for(uint8_t i = 0; i < LiftLatencyCount; ++i) {
+        _stats[i].count = 0;
+        _stats[i].last_ms = 0.0f;
+        _stats[i].min_ms = 0.0f;
+        _stats[i].max_ms = 0.0f;
+        _stats[i].mean_ms = 0.0f;
+    }
+}
+
+// ! ========================= 私 有 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   记录一个样本
+ * @param   which 条目
+ * @param   cycles 延迟 (CPU 周期)
+ * @retval  None
+ */
+static void _record(LiftLatency_e which, uint32_t cycles) {
+    lift_latency_stat_t* st = &_stats[which];
+    float ms = (float)cycles / (float)_cycles_per_ms;
+
+    st->last_ms = ms;
+    if(st->count == 0 || ms < st->min_ms) st->min_ms = ms;
+    if(st->count == 0 || ms > st->max_ms) st->max_ms = ms;
+    st->count++;
+    st->mean_ms += (ms - st->mean_ms) / (float)st->count;
+}
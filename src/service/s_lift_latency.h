@@ -0,0 +1,53 @@
+/**
+ * @file    s_lift_latency.h
+ * @brief   升降台驱动延迟测量服务
+ * @note    每次驱动方向改变时以 DWT 周期计数打时间戳, 主循环中轮询编码器计数:
+ *
+ *          起动延迟: 停止 -> 驱动     到第一个编码器边沿 (继电器吸合 + 电机克服静摩擦)
+ *          停车时间: 驱动 -> 停止     到最后一个边沿 (之后 still_ms 内无边沿, 即惯性滑行结束)
+ *
+ *          按方向分别统计. 轮询在主循环中进行, 分辨率为一次主循环耗时, 远小于控制周期;
+ *          起动延迟的均值可作为位置控制的预测超前时间
+ */
+#ifndef _s_lift_latency_h_
+#define _s_lift_latency_h_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// ! ========================= 接 口 变 量 / Typedef 声 明 ========================= ! //
+
+// 起动后超过该时间仍无边沿: 放弃本次测量 (堵转由运动监视处理)
+#define LIFT_LATENCY_TIMEOUT_MS     500u
+// 停车后无边沿持续该时间视为静止
+#define LIFT_LATENCY_STILL_MS       50u
+
+typedef enum {
+    LiftLatencyStartUp = 0,
+    LiftLatencyStartDown,
+    LiftLatencyStopUp,
+    LiftLatencyStopDown,
+    LiftLatencyCount
+} LiftLatency_e;
+
+/**
+ * @brief 延迟统计 (ms)
+ */
+typedef struct {
+    uint32_t count;
+    float last_ms;
+    float min_ms;
+    float max_ms;
+    float mean_ms;
+} lift_latency_stat_t;
+
+// ! ========================= 接 口 函 数 声 明 ========================= ! //
+
+void s_lift_latency_init(uint32_t (*get_cycles)(void), int64_t (*read_pulses)(void), uint32_t cycles_per_ms);
+void s_lift_latency_command(int8_t dir);
+void s_lift_latency_poll(void);
+void s_lift_latency_get(LiftLatency_e which, lift_latency_stat_t* out);
+float s_lift_latency_lead_s(int8_t dir);
+void s_lift_latency_reset(void);
+
+#endif
@@ -0,0 +1,87 @@
+/**
+ * @file    s_lift_limit.c
+ * @brief   升降台软限位服务实现
+ */
+#include "s_lift_limit.h"
+
+#include <math.h>
+
+// ! ========================= 变 量 声 明 ========================= ! //
+
+static const lift_limit_cfg_t* _cfg = 0;
+static float _min_mm = 0.0f;
+static float _max_mm = 0.0f;
+
+// ! ========================= 私 有 函 数 声 明 ========================= ! //
+
+
+
+// ! ========================= 接 口 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   初始化软限位 (使用参数中的默认限位)
+ * @param   cfg 参数
+ * @retval  None
+ */
+void s_lift_limit_init(const lift_limit_cfg_t* cfg) {
+    _cfg = cfg;
+    _min_mm = cfg->min_mm;
+    _max_mm = cfg->max_mm;
+}
+
+/**
+ * @brief   修改软限位
+ * @param   min_mm 下限位
+ * @param   max_mm 上限位
+ * @retval  bool true:成功, false:范围无效 (min >= max)
+ */
+bool s_lift_limit_set(float min_mm, float max_mm) {
+    if(!(min_mm < max_mm)) return false;
+    _min_mm = min_mm;
+    _max_mm = max_mm;
+    return true;
+}
+
+/**
+ * @brief   获取当前软限位
+ * @param   min_mm 下限位输出
+ * @param   max_mm 上限位输出
+ * @retval  None
+ */
+void s_lift_limit_get(float* min_mm, float* max_mm) {
+    *min_mm = _min_mm;
+    *max_mm = _max_mm;
+}
+
+/**
+ * @brief   将目标位置钳位到软限位内
+ * @param   target_mm 目标位置
+ * @retval  float 钳位后的目标
+ */
+float s_lift_limit_clamp(float target_mm) {
+    if(!_cfg) return target_mm;
+    if(target_mm < _min_mm) return _min_mm;
+    if(target_mm > _max_mm) return _max_mm;
+    return target_mm;
+}
+
+/**
+ * @brief   计算朝某方向允许的驱动幅度
+ * @param   pos_mm 当前位置
+ * @param   speed_mm_s 当前速度 (正为上行)
+ * @param   dir 驱动方向: 1 上行, -1 下行
+ * @retval  float 驱动幅度上限 (0 ~ 1), 0 表示必须断开
+ * @note    背离限位方向的速度不受限制
+ */
+float s_lift_limit_drive(float pos_mm, float speed_mm_s, int8_t dir) {
+    if(!_cfg || dir == 0) return 1.0f;
+
+    float d = (dir > 0) ? (_max_mm - pos_mm) : (pos_mm - _min_mm);
+    if(d <= 0.0f) return 0.0f;
+
+    float v_allow = sqrtf(_cfg->creep_mm_s * _cfg->creep_mm_s + 2.0f * _cfg->decel_mm_s2 * d);
+    if(speed_mm_s * (float)dir > v_allow) return 0.0f;
+
+    float scale = v_allow / _cfg->full_speed_mm_s;
+    return scale < 1.0f ? scale : 1.0f;
+}
@@ -0,0 +1,45 @@
+/**
+ * @file    s_lift_limit.h
+ * @brief   升降台软限位服务
+ * @note    目标位置钳位到 [min_mm, max_mm]; 点动时按到限位的剩余距离 d 限制允许速度:
+ *
+ *          v_allow(d) = sqrt(v_creep^2 + 2 · a · d)
+ *
+ *          速度 ^
+ *          full |--------------.
+ *               |               `.             实测速度超过 v_allow 时断开驱动,
+ *               |                 `.           低于时恢复; PWM 方式按 v_allow / full 限幅
+ *         creep |                   `|
+ *               +--------------------+---> 位置
+ *                                   max
+ *
+ *          减速区长度随速度变化: 以全速接近时为 (full^2 - creep^2) / 2a, 低速时更短
+ */
+#ifndef _s_lift_limit_h_
+#define _s_lift_limit_h_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// ! ========================= 接 口 变 量 / Typedef 声 明 ========================= ! //
+
+/**
+ * @brief 软限位参数
+ */
+typedef struct {
+    float min_mm;                   // 下软限位 (默认值, 可在运行时修改)
+    float max_mm;                   // 上软限位
+    float decel_mm_s2;              // 减速区内按此减速度限制速度 (应小于实际停车减速度)
+    float creep_mm_s;               // 限位处允许的速度
+    float full_speed_mm_s;          // 满驱动时的速度 (换算占空比)
+} lift_limit_cfg_t;
+
+// ! ========================= 接 口 函 数 声 明 ========================= ! //
+
+void s_lift_limit_init(const lift_limit_cfg_t* cfg);
+bool s_lift_limit_set(float min_mm, float max_mm);
+void s_lift_limit_get(float* min_mm, float* max_mm);
+float s_lift_limit_clamp(float target_mm);
+float s_lift_limit_drive(float pos_mm, float speed_mm_s, int8_t dir);
+
+#endif
@@ -0,0 +1,112 @@
+/**
+ * @file    s_lift_monitor.c
+ * @brief   升降台运动监视服务实现
+ */
+#include "s_lift_monitor.h"
+
+// ! ========================= 变 量 声 明 ========================= ! //
+
+#define RING_SIZE   (LIFT_MONITOR_MAX_WINDOW + 1)
+
+static const lift_monitor_cfg_t* _cfg = 0;
+static LiftFault_e _fault = LiftFaultNone;
+
+static int8_t _dir = 0;             // 上一周期指令方向
+static uint8_t _grace = 0;          // 当前方向已经过的宽限周期
+static uint8_t _count = 0;          // 窗口内有效样本数 (≤ window + 1)
+static uint8_t _head = 0;           // 下一个样本写入位置
+static int64_t _ring[RING_SIZE];
+
+// ! ========================= 私 有 函 数 声 明 ========================= ! //
+
+static void _restart(int8_t dir);
+
+// ! ========================= 接 口 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   初始化运动监视
+ * @param   cfg 监视参数
+ * @retval  None
+ */
+void s_lift_monitor_init(const lift_monitor_cfg_t* cfg) {
+    _cfg = cfg;
+    s_lift_monitor_reset();
+}
+
+/**
+ * @brief   运动监视周期处理 (每个控制周期调用一次)
+ * @param   dir 当前指令方向: 1 上行, -1 下行, 0 停止
+ * @param   driven 当前驱动应使平台运动 (为 false 时不判断堵转)
+ * @param   pulses 编码器累计脉冲数
+ * @retval  LiftFault_e 故障 (已锁存的故障持续返回)
+ */
+LiftFault_e s_lift_monitor_update(int8_t dir, bool driven, int64_t pulses) {
+    if(!_cfg || _fault != LiftFaultNone) return _fault;
+
+    if(dir != _dir) _restart(dir);
+
+    uint8_t grace = dir ? _cfg->start_grace_ticks : _cfg->stop_grace_ticks;
+    if(_grace < grace) {
+        _grace++;
+        return LiftFaultNone;
+    }
+
+    _ring[_head] = pulses;
+    _head = (uint8_t)((_head + 1) % RING_SIZE);
+    if(_count <= _cfg->window_ticks) _count++;
+
+    /* 窗口内最早的样本 */
+    int64_t oldest = _ring[(_head + RING_SIZE - _count) % RING_SIZE];
+    int64_t delta = pulses - oldest;
+
+    if(dir) {
+        int64_t along = dir > 0 ? delta : -delta;
+        if(along < -(int64_t)_cfg->wrong_dir_pulses) {
+            _fault = LiftFaultWrongDir;
+        }
+        else if(driven && _count > _cfg->window_ticks && along < _cfg->stall_pulses) {
+            _fault = LiftFaultStall;
+        }
+    }
+    else {
+        if(delta > _cfg->creep_pulses || delta < -(int64_t)_cfg->creep_pulses) {
+            _fault = LiftFaultCreep;
+        }
+    }
+
+    return _fault;
+}
+
+/**
+ * @brief   获取已锁存的故障
+ * @param   None
+ * @retval  LiftFault_e 故障
+ */
+LiftFault_e s_lift_monitor_fault(void) {
+    return _fault;
+}
+
+/**
+ * @brief   清除故障并重新开始监视
+ * @param   None
+ * @retval  None
+ * @note    重新开始时按停止指令处理, 先经过停止宽限期
+ */
+void s_lift_monitor_reset(void) {
+    _fault = LiftFaultNone;
+    _restart(0);
+}
+
+// ! ========================= 私 有 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   指令方向改变, 清空窗口并重新计宽限期
+ * @param   dir 新指令方向
+ * @retval  None
+ */
+static void _restart(int8_t dir) {
+    _dir = dir;
+    _grace = 0;
+    _count = 0;
+    _head = 0;
+}
@@ -0,0 +1,53 @@
+/**
+ * @file    s_lift_monitor.h
+ * @brief   升降台运动监视服务
+ * @note    每个控制周期比较指令方向 (继电器方向或 PWM 占空比符号) 与编码器在滑动窗口内的位移:
+ *
+ *          指令方向        窗口位移 (沿指令方向)      判定
+ *          上/下           < -wrong_dir_pulses       反向运动 (接线/编码器极性错误, 负载下坠)
+ *          上/下, 应运动    <  stall_pulses (满窗口)  堵转 (卡死, 皮带断, 编码器断线)
+ *          停止            |位移| > creep_pulses     停止时运动 (继电器粘连, 下滑)
+ *
+ *          "应运动" 由调用方给出: 定位末段 PID 只修正剩余误差、辨识时占空比从 0 增大等情况,
+ *          驱动不为 0 而平台静止属于正常, 此时只检查反向运动;
+ *          指令方向改变后先等待宽限期 (继电器吸合/电机加速或停车惯性), 再开始填充窗口;
+ *          故障在宽限期 + 窗口长度个周期内确定, 并保持到 s_lift_monitor_reset
+ */
+#ifndef _s_lift_monitor_h_
+#define _s_lift_monitor_h_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// ! ========================= 接 口 变 量 / Typedef 声 明 ========================= ! //
+
+// 滑动窗口最大长度 (周期数)
+#define LIFT_MONITOR_MAX_WINDOW 32
+
+typedef enum {
+    LiftFaultNone = 0,
+    LiftFaultStall,                 // 应运动但位移不足
+    LiftFaultWrongDir,              // 位移方向与指令相反
+    LiftFaultCreep                  // 停止指令下仍在运动
+} LiftFault_e;
+
+/**
+ * @brief 监视参数 (单位: 控制周期 / 脉冲)
+ */
+typedef struct {
+    uint8_t window_ticks;           // 滑动窗口长度 (≤ LIFT_MONITOR_MAX_WINDOW)
+    uint8_t start_grace_ticks;      // 开始驱动后的宽限期
+    uint8_t stop_grace_ticks;       // 停止后的宽限期 (惯性滑行)
+    int32_t stall_pulses;           // 满窗口内沿指令方向的最小位移
+    int32_t wrong_dir_pulses;       // 反向位移阈值
+    int32_t creep_pulses;           // 停止时窗口内位移阈值
+} lift_monitor_cfg_t;
+
+// ! ========================= 接 口 函 数 声 明 ========================= ! //
+
+void s_lift_monitor_init(const lift_monitor_cfg_t* cfg);
+LiftFault_e s_lift_monitor_update(int8_t dir, bool driven, int64_t pulses);
+LiftFault_e s_lift_monitor_fault(void);
+void s_lift_monitor_reset(void);
+
+#endif
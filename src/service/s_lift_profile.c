@@ -0,0 +1,205 @@
+/**
+ * @file    s_lift_profile.c
+ * @brief   升降台运动轨迹规划服务实现
+ */
+#include "s_lift_profile.h"
+
+#include <math.h>
+
+// ! ========================= 变 量 声 明 ========================= ! //
+
+static const lift_profile_cfg_t* _cfg = 0;
+
+static float _target = 0.0f;
+static bool _done = true;
+
+/* 内部梯形 */
+static float _tpos = 0.0f;
+static float _tvel = 0.0f;
+static bool _tdone = true;
+
+/* 滑动平均 */
+static float _vbuf[LIFT_PROFILE_MAX_TAPS];
+static float _vsum = 0.0f;
+static uint8_t _taps = 1;
+static uint8_t _head = 0;
+
+/* 输出参考 */
+static float _pos = 0.0f;
+static float _vel = 0.0f;
+static float _acc = 0.0f;
+
+// ! ========================= 私 有 函 数 声 明 ========================= ! //
+
+static void _trapezoid_step(float dt_s);
+
+// ! ========================= 接 口 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   初始化轨迹规划
+ * @param   cfg 轨迹约束
+ * @retval  None
+ */
+void s_lift_profile_init(const lift_profile_cfg_t* cfg) {
+    _cfg = cfg;
+
+    _taps = 1;
+    if(cfg->j_max > 0.0f) {
+        float n = cfg->a_max / (cfg->j_max * cfg->tick_s) + 0.5f;
+        if(n > LIFT_PROFILE_MAX_TAPS) n = LIFT_PROFILE_MAX_TAPS;
+        if(n >= 1.0f) _taps = (uint8_t)n;
+    }
+
+    s_lift_profile_reset(0.0f, 0.0f);
+}
+
+/**
+ * @brief   以给定状态重置参考 (目标设为当前位置)
+ * @param   pos_mm 位置
+ * @param   vel_mm_s 速度
+ * @retval  None
+ * @note    运动开始时以实测状态重置, 避免参考与实际脱节
+ */
+void s_lift_profile_reset(float pos_mm, float vel_mm_s) {
+    _target = pos_mm;
+    _tpos = pos_mm;
+    _tvel = vel_mm_s;
+    _tdone = (vel_mm_s == 0.0f);
+
+    for(uint8_t i = 0; i < _taps; ++i) _vbuf[i] = vel_mm_s;
+    _vsum = vel_mm_s * (float)_taps;
+    _head = 0;
+
+    _pos = pos_mm;
+    _vel = vel_mm_s;
+    _acc = 0.0f;
+    _done = _tdone;
+}
+
+/**
+ * @brief   设置 (或在运动中更换) 目标位置
+ * @param   target_mm 目标位置
+ * @retval  None
+ */
+void s_lift_profile_set_target(float target_mm) {
+    _target = target_mm;
+    if(_tpos != target_mm || _tvel != 0.0f) _tdone = false;
+    if(!_tdone || _pos != target_mm) _done = false;
+}
+
+/**
+ * @brief   推进一个周期
+ * @param   None
+ * @retval  bool true:已到达目标并静止
+ */
+bool s_lift_profile_update(void) {
+    if(!_cfg || _done) return _done;
+
+    float dt_s = _cfg->tick_s;
+
+    if(!_tdone) _trapezoid_step(dt_s);
+
+    /* 梯形速度滑动平均 -> S 形 */
+    _vsum += _tvel - _vbuf[_head];
+    _vbuf[_head] = _tvel;
+    if(++_head >= _taps) _head = 0;
+
+    float vel = _vsum / (float)_taps;
+    _acc = (vel - _vel) / dt_s;
+    _pos += 0.5f * (_vel + vel) * dt_s;
+    _vel = vel;
+
+    /* 梯形已结束且窗口内速度全部为 0: 消除累计舍入误差 */
+    if(_tdone) {
+        bool idle = true;
+        for(uint8_t i = 0; i < _taps; ++i) {
+            if(_vbuf[i] != 0.0f) { idle = false; break; }
+        }
+        if(idle) {
+            _vsum = 0.0f;
+            _pos = _target;
+            _vel = 0.0f;
+            _acc = 0.0f;
+            _done = true;
+        }
+    }
+
+    return _done;
+}
+
+/**
+ * @brief   获取当前目标
+ * @retval  float 目标位置 (mm)
+ */
+float s_lift_profile_target(void) {
+    return _target;
+}
+
+/**
+ * @brief   获取参考位置
+ * @retval  float 位置 (mm)
+ */
+float s_lift_profile_pos(void) {
+    return _pos;
+}
+
+/**
+ * @brief   获取参考速度
+ * @retval  float 速度 (mm/s)
+ */
+float s_lift_profile_vel(void) {
+    return _vel;
+}
+
+/**
+ * @brief   获取参考加速度
+ * @retval  float 加速度 (mm/s^2)
+ */
+float s_lift_profile_acc(void) {
+    return _acc;
+}
+
+/**
+ * @brief   是否已到达目标并静止
+ * @retval  bool true:已完成
+ */
+bool s_lift_profile_done(void) {
+    return _done;
+}
+
+// ! ========================= 私 有 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   梯形轨迹推进一个周期
+ * @param   dt_s 周期 (s)
+ * @retval  None
+ * @note    离散制动曲线 v = sqrt((a·dt/2)^2 + 2·a·r) - a·dt/2, 保证按周期减速时恰好停在目标
+ */
+static void _trapezoid_step(float dt_s) {
+    float a_max = _cfg->a_max;
+
+    /* 以指向目标为正方向 */
+    float dir = (_target >= _tpos) ? 1.0f : -1.0f;
+    float r = (_target - _tpos) * dir;
+    float s = _tvel * dir;
+
+    float h = 0.5f * a_max * dt_s;
+    float v_des = sqrtf(h * h + 2.0f * a_max * r) - h;
+    if(v_des > _cfg->v_max) v_des = _cfg->v_max;
+
+    float dv = v_des - s;
+    float lim = a_max * dt_s;
+    if(dv > lim) dv = lim;
+    if(dv < -lim) dv = -lim;
+    float s_new = s + dv;
+
+    _tpos += 0.5f * (s + s_new) * dt_s * dir;
+    _tvel = s_new * dir;
+
+    /* 剩余距离不足一个周期的行程且速度已降到一个周期的加速度以内: 到达 */
+    if(fabsf(_target - _tpos) <= fabsf(_tvel) * dt_s + 1e-3f && fabsf(_tvel) <= lim) {
+        _tpos = _target;
+        _tvel = 0.0f;
+        _tdone = true;
+    }
+}
@@ -0,0 +1,51 @@
+/**
+ * @file    s_lift_profile.h
+ * @brief   升降台运动轨迹规划服务
+ * @note    在线生成位置/速度/加速度参考, 每个控制周期采样一次:
+ *
+ *          速度 ^      ______________
+ *               |     /              \          j_max > 0: S 形 (加速度按 j_max 斜坡变化)
+ *               |    /                \         j_max = 0: 梯形 (加速度阶跃)
+ *               |___/                  \___
+ *                                         t
+ *
+ *          内部先生成梯形: 每周期按制动曲线 v = sqrt(2·a·r) 限制速度, 以 a_max 逼近.
+ *          S 形由梯形速度经长度 T = a_max / j_max 的滑动平均得到 (矩形窗卷积),
+ *          加加速度恰为 j_max, 且滑动平均不改变总位移, 终点不变.
+ *          运动中更换目标只改变内部梯形的目标, 参考状态连续, 速度不会跳变;
+ *          反向目标会先减速到 0 再反向
+ */
+#ifndef _s_lift_profile_h_
+#define _s_lift_profile_h_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// ! ========================= 接 口 变 量 / Typedef 声 明 ========================= ! //
+
+// S 形滑动平均最大长度 (周期数), a_max / j_max 超出时按此截断
+#define LIFT_PROFILE_MAX_TAPS   32
+
+/**
+ * @brief 轨迹约束
+ */
+typedef struct {
+    float v_max;                    // 最大速度 (mm/s)
+    float a_max;                    // 最大加速度 (mm/s^2)
+    float j_max;                    // 最大加加速度 (mm/s^3), 0 = 梯形
+    float tick_s;                   // 采样周期 (s), 即 update 调用周期
+} lift_profile_cfg_t;
+
+// ! ========================= 接 口 函 数 声 明 ========================= ! //
+
+void s_lift_profile_init(const lift_profile_cfg_t* cfg);
+void s_lift_profile_reset(float pos_mm, float vel_mm_s);
+void s_lift_profile_set_target(float target_mm);
+bool s_lift_profile_update(void);
+float s_lift_profile_target(void);
+float s_lift_profile_pos(void);
+float s_lift_profile_vel(void);
+float s_lift_profile_acc(void);
+bool s_lift_profile_done(void);
+
+#endif
@@ -0,0 +1,142 @@
+/**
+ * @file    s_lift_queue.c
+ * @brief   升降台航点队列服务实现
+ */
+#include "s_lift_queue.h"
+
+// ! ========================= 变 量 声 明 ========================= ! //
+
+static lift_wp_t _buf[LIFT_QUEUE_SIZE];
+static uint8_t _head = 0;
+static uint8_t _count = 0;
+static uint32_t _reached = 0;       // 自上次清空以来已到达的航点数
+
+// ! ========================= 私 有 函 数 声 明 ========================= ! //
+
+static const lift_wp_t* _at(uint8_t idx);
+
+// ! ========================= 接 口 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   追加航点
+ * @param   pos_mm 目标位置
+ * @param   dwell_ms 到达后停留时间
+ * @retval  bool true:成功, false:队列已满
+ */
+bool s_lift_queue_push(float pos_mm, uint32_t dwell_ms) {
+    if(_count >= LIFT_QUEUE_SIZE) return false;
+
+    uint8_t tail = (uint8_t)((_head + _count) % LIFT_QUEUE_SIZE);
+    _buf[tail].pos_mm = pos_mm;
+    _buf[tail].dwell_ms = dwell_ms;
+    _count++;
+    return true;
+}
+
+/**
+ * @brief   查看航点 (不出队)
+ * @param   idx 距队首的序号 (0 = 队首)
+ * @param   out 输出
+ * @retval  bool true:存在该航点
+ */
+bool s_lift_queue_peek(uint8_t idx, lift_wp_t* out) {
+    if(idx >= _count) return false;
+    *out = *_at(idx);
+    return true;
+}
+
+/**
+ * @brief   队首航点出队 (已到达)
+ * @param   out 输出, 可为 0
+ * @retval  bool true:成功, false:队列为空
+ */
+bool s_lift_queue_pop(lift_wp_t* out) {
+    if(_count == 0) return false;
+
+    if(out) *out = _buf[_head];
+    _head = (uint8_t)((_head + 1) % LIFT_QUEUE_SIZE);
+    _count--;
+    _reached++;
+    return true;
+}
+
+/**
+ * @brief   清空队列并清零到达计数
+ * @param   None
+ * @retval  None
+ */
+void s_lift_queue_clear(void) {
+    _head = 0;
+    _count = 0;
+    _reached = 0;
+}
+
+/**
+ * @brief   获取队列中剩余航点数
+ * @param   None
+ * @retval  uint8_t 航点数
+ */
+uint8_t s_lift_queue_count(void) {
+    return _count;
+}
+
+/**
+ * @brief   获取自上次清空以来已到达的航点数
+ * @param   None
+ * @retval  uint32_t 航点数
+ */
+uint32_t s_lift_queue_reached(void) {
+    return _reached;
+}
+
+/**
+ * @brief   计算从当前位置出发可以连续衔接的航点数
+ * @param   pos_mm 当前位置
+ * @retval  uint8_t 航点数 n (队列为空时为 0), 应以第 n - 1 个航点为运动目标
+ * @note    从队首开始, 只要本航点停留时间为 0 且下一航点沿同一方向继续前进就向后延伸
+ */
+uint8_t s_lift_queue_blend(float pos_mm) {
+    if(_count == 0) return 0;
+
+    float prev = _at(0)->pos_mm;
+    float dir = (prev >= pos_mm) ? 1.0f : -1.0f;
+    uint8_t n = 1;
+
+    while(n < _count && _at(n - 1)->dwell_ms == 0) {
+        float next = _at(n)->pos_mm;
+        if((next - prev) * dir <= 0.0f) break;
+        prev = next;
+        n++;
+    }
+
+    return n;
+}
+
+/**
+ * @brief   未执行的航点钳位到 [min_mm, max_mm] (软限位修改后调用)
+ * @param   min_mm 下限
+ * @param   max_mm 上限
+ * @retval  uint8_t 被钳位的航点数
+ */
+uint8_t s_lift_queue_clamp(float min_mm, float max_mm) {
+    uint8_t n = 0;
+    for(uint8_t i = 0; i < _count; ++i) {
+        lift_wp_t* wp = &_buf[(_head + i) % LIFT_QUEUE_SIZE];
+        if(wp->pos_mm < min_mm) wp->pos_mm = min_mm;
+        else if(wp->pos_mm > max_mm) wp->pos_mm = max_mm;
+        else continue;
+        n++;
+    }
+    return n;
+}
+
+// ! ========================= 私 有 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   按距队首的序号取航点
+ * @param   idx 序号 (调用者保证 < _count)
+ * @retval  const lift_wp_t* 航点
+ */
+static const lift_wp_t* _at(uint8_t idx) {
+    return &_buf[(_head + idx) % LIFT_QUEUE_SIZE];
+}
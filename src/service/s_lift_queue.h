@@ -0,0 +1,46 @@
+/**
+ * @file    s_lift_queue.h
+ * @brief   升降台航点队列服务
+ * @note    上位机可一次下发多个航点, 由状态机依次执行, 到达后按航点停留时间等待.
+ *          停留时间为 0 且下一航点与之同向时两段可以衔接, 中途不停车:
+ *
+ *          位置 ^          C (停留)
+ *               |      B  /
+ *               |  A  /                 A, B 停留 0 且 A→B→C 单调: 直接以 C 为目标,
+ *               | /  /                  途经 A, B 时只报告不停车
+ *               |/
+ *               +-------------> t
+ *
+ *          队首始终是下一个要到达的航点, 只在到达 (或途经) 后出队
+ */
+#ifndef _s_lift_queue_h_
+#define _s_lift_queue_h_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// ! ========================= 接 口 变 量 / Typedef 声 明 ========================= ! //
+
+// 队列容量
+#define LIFT_QUEUE_SIZE     16
+
+/**
+ * @brief 航点
+ */
+typedef struct {
+    float pos_mm;                   // 目标位置
+    uint32_t dwell_ms;              // 到达后停留时间
+} lift_wp_t;
+
+// ! ========================= 接 口 函 数 声 明 ========================= ! //
+
+bool s_lift_queue_push(float pos_mm, uint32_t dwell_ms);
+bool s_lift_queue_peek(uint8_t idx, lift_wp_t* out);
+bool s_lift_queue_pop(lift_wp_t* out);
+void s_lift_queue_clear(void);
+uint8_t s_lift_queue_count(void);
+uint32_t s_lift_queue_reached(void);
+uint8_t s_lift_queue_blend(float pos_mm);
+uint8_t s_lift_queue_clamp(float min_mm, float max_mm);
+
+#endif
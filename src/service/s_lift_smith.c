@@ -0,0 +1,158 @@
+/**
+ * @file    s_lift_smith.c
+ * @brief   升降台纯滞后补偿服务实现
+ */
+#include "s_lift_smith.h"
+
+// ! ========================= 变 量 声 明 ========================= ! //
+
+#define LIFT_SMITH_V_SCALE      1000.0f     // 缓冲区速度单位 0.001 mm/s
+
+static const lift_smith_cfg_t* _cfg = 0;
+static lift_fopdt_t _model;
+static bool _model_valid = false;
+static bool _enabled = false;
+
+static int32_t _buf[LIFT_SMITH_MAX_DELAY];  // 最近 N 个周期的模型速度 (无滞后)
+static uint8_t _len;                        // N: 纯滞后周期数
+static uint8_t _head;                       // 最早样本的位置 (即下一个写入位置)
+static int32_t _sum;                        // 缓冲区之和
+static float _v;                            // 模型速度 (无滞后)
+static float _d;                            // 输入端扰动估计 (占空比)
+static float _obs_gain;                     // 1 / (K · obs_tau), 设置模型时预先算好
+
+// ! ========================= 私 有 函 数 声 明 ========================= ! //
+
+static int32_t _quant(float v_mm_s);
+
+// ! ========================= 接 口 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   初始化预估器 (未设置模型前不启用)
+ * @param   cfg 预估器参数
+ * @retval  None
+ */
+void s_lift_smith_init(const lift_smith_cfg_t* cfg) {
+    _cfg = cfg;
+    _model_valid = false;
+    _enabled = false;
+    _len = 0;
+    s_lift_smith_reset(0.0f);
+}
+
+/**
+ * @brief   设置模型 (辨识结果或 Flash 中保存的模型), 设置成功后启用
+ * @param   model 模型
+ * @retval  bool true:成功, false:参数无效
+ * @note    纯滞后超过 LIFT_SMITH_MAX_DELAY 个周期时按最大值补偿
+ */
+bool s_lift_smith_set_model(const lift_fopdt_t* model) {
+    if(!_cfg || !model || !(model->k_mm_s > 0.0f) || model->tau_s < 0.0f || model->dead_s < 0.0f) return false;
+
+    float n = model->dead_s / _cfg->period_s + 0.5f;
+    _len = (n >= (float)LIFT_SMITH_MAX_DELAY) ? LIFT_SMITH_MAX_DELAY : (uint8_t)n;
+    _model = *model;
+    _obs_gain = 1.0f / (model->k_mm_s * _cfg->obs_tau_s);
+    _model_valid = true;
+    _enabled = true;
+    _d = 0.0f;
+    s_lift_smith_reset(0.0f);
+    return true;
+}
+
+/**
+ * @brief   获取当前模型
+ * @param   None
+ * @retval  const lift_fopdt_t* 模型, 未设置时为 0
+ */
+const lift_fopdt_t* s_lift_smith_model(void) {
+    return _model_valid ? &_model : 0;
+}
+
+/**
+ * @brief   启用 / 停用预估 (无模型时不能启用)
+ * @param   enable true:启用
+ * @retval  None
+ */
+void s_lift_smith_enable(bool enable) {
+    _enabled = enable && _model_valid;
+}
+
+/**
+ * @brief   预估是否启用
+ * @param   None
+ * @retval  bool true:启用
+ */
+bool s_lift_smith_enabled(void) {
+    return _enabled;
+}
+
+/**
+ * @brief   开始一次定位: 按当前速度填充模型状态 (视为已匀速运行超过 L)
+ * @param   speed_mm_s 当前速度 (静止时为 0)
+ * @retval  None
+ * @note    扰动估计保留 (负载通常不随定位改变)
+ */
+void s_lift_smith_reset(float speed_mm_s) {
+    int32_t q = _quant(speed_mm_s);
+    for(uint8_t i = 0; i < LIFT_SMITH_MAX_DELAY; ++i) {
+        _buf[i] = q;
+    }
+    _sum = q * (int32_t)_len;
+    _head = 0;
+    _v = speed_mm_s;
+}
+
+/**
+ * @brief   预估周期处理 (每个控制周期调用一次)
+ * @param   pos_mm 实测位置
+ * @param   speed_mm_s 实测速度
+ * @param   u 上一周期实际施加的驱动指令
+ * @param   dt_s 距上次调用的时间
+ * @retval  float 预估位置 (纯滞后之后); 未启用时为实测位置
+ */
+float s_lift_smith_update(float pos_mm, float speed_mm_s, float u, float dt_s) {
+    if(!_enabled) return pos_mm;
+
+    /* 模型速度 (无滞后), 输入含扰动估计 */
+    _v += (_model.k_mm_s * (u + _d) - _v) * dt_s / (_model.tau_s + dt_s);
+    int32_t q = _quant(_v);
+
+    /* 环形缓冲区: 取出 N 个周期前的模型速度 (即有滞后模型的当前速度), 写入当前值 */
+    int32_t old = q;
+    if(_len > 0) {
+        old = _buf[_head];
+        _buf[_head] = q;
+        _sum += q - old;
+        if(++_head >= _len) _head = 0;
+    }
+
+    /* 扰动估计: 实测速度与有滞后模型速度之差折算到输入端 */
+    float v_delayed = (float)old / LIFT_SMITH_V_SCALE;
+    _d += (speed_mm_s - v_delayed) * _obs_gain * dt_s;
+    if(_d > 1.0f) _d = 1.0f;
+    if(_d < -1.0f) _d = -1.0f;
+
+    return pos_mm + (float)_sum / LIFT_SMITH_V_SCALE * _cfg->period_s;
+}
+
+/**
+ * @brief   获取输入端扰动估计
+ * @param   None
+ * @retval  float 扰动 (占空比, 正为向上)
+ */
+float s_lift_smith_disturbance(void) {
+    return _d;
+}
+
+// ! ========================= 私 有 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   速度量化
+ * @param   v_mm_s 速度
+ * @retval  int32_t 0.001 mm/s
+ */
+static int32_t _quant(float v_mm_s) {
+    float q = v_mm_s * LIFT_SMITH_V_SCALE;
+    return (int32_t)(q >= 0.0f ? q + 0.5f : q - 0.5f);
+}
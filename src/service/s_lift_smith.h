@@ -0,0 +1,54 @@
+/**
+ * @file    s_lift_smith.h
+ * @brief   升降台纯滞后补偿服务 (Smith 预估器)
+ * @note    继电器吸合与电机起步使指令在纯滞后 L 之后才反映到编码器, 位置 PID 看到的是 L 之前的结果,
+ *          增益稍大即振荡. 预估器用辨识得到的模型 (s_lift_ident) 给出 L 之后的位置作为 PID 反馈:
+ *
+ *          u ──┬──────────────────→ 对象 K·e^(-Ls)/(τs+1)/s ──→ y ──┐
+ *              │                                                     (+) ──→ ŷ = y + Σ v̂·T  → PID
+ *              └→ (+) ─→ K/(τs+1) ─→ v̂ ─→ [最近 N = L/T 个 v̂ 之和]·T ──┘
+ *                  ↑ d̂                 └→ v̂ 延迟 N 周期 ─┐
+ *                  └──── (v - v̂延迟) / K · T / obs_tau ←──┘ 编码器速度 v
+ *
+ *          ŷ - y = 模型无滞后位置 - 模型有滞后位置 = 最近 L 内已发出、尚未生效的指令将产生的位移.
+ *          对象含积分, 常值负载 (重力, 摩擦) 下保持位置需要非零输出, 标准 Smith 结构会因此留下
+ *          K·u·L 的稳态误差; 这里把输入端扰动 d̂ 加到模型输入上, d̂ 由延迟后的模型速度与实测速度之差
+ *          以 obs_tau 缓慢估计, 静止时模型速度回到 0, 预估量也回到 0.
+ *          v̂ 按 0.001 mm/s 量化为整数存入环形缓冲区, 滑动和按整数增减, 不累积舍入误差;
+ *          每周期只有固定次数的运算, 与 L 无关 (不遍历缓冲区)
+ */
+#ifndef _s_lift_smith_h_
+#define _s_lift_smith_h_
+
+#include "s_lift_ident.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// ! ========================= 接 口 变 量 / Typedef 声 明 ========================= ! //
+
+// 可补偿的最大纯滞后 (控制周期数), 超出时按该值补偿
+#ifndef LIFT_SMITH_MAX_DELAY
+#define LIFT_SMITH_MAX_DELAY    32u
+#endif
+
+/**
+ * @brief 预估器参数
+ */
+typedef struct {
+    float period_s;                 // 名义控制周期 (纯滞后换算为周期数)
+    float obs_tau_s;                // 扰动估计时间常数 (应为纯滞后的数倍以上)
+} lift_smith_cfg_t;
+
+// ! ========================= 接 口 函 数 声 明 ========================= ! //
+
+void s_lift_smith_init(const lift_smith_cfg_t* cfg);
+bool s_lift_smith_set_model(const lift_fopdt_t* model);
+const lift_fopdt_t* s_lift_smith_model(void);
+void s_lift_smith_enable(bool enable);
+bool s_lift_smith_enabled(void);
+void s_lift_smith_reset(float speed_mm_s);
+float s_lift_smith_update(float pos_mm, float speed_mm_s, float u, float dt_s);
+float s_lift_smith_disturbance(void);
+
+#endif
@@ -0,0 +1,109 @@
+/**
+ * @file    s_param.c
+ * @brief   掉电保存参数服务实现
+ */
+#include "s_param.h"
+#include "flash.h"
+
+#include <string.h>
+
+// ! ========================= 变 量 声 明 ========================= ! //
+
+#define PARAM_MAGIC     0x4D524150u     // "PARM"
+
+/**
+ * @brief Flash 记录头
+ */
+typedef struct {
+    uint32_t magic;
+    uint32_t size;                  // 参数体字节数
+    uint32_t crc;                   // 参数体 CRC32
+} param_hdr_t;
+
+static uint32_t _flash_addr = 0;
+static param_t _param;
+
+// ! ========================= 私 有 函 数 声 明 ========================= ! //
+
+static uint32_t _crc32(const void* data, uint32_t len);
+
+// ! ========================= 接 口 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   参数服务初始化
+ * @param   flash_addr 参数页起始地址 (整页保留给参数, 不得被程序占用)
+ * @retval  None
+ */
+void s_param_init(uint32_t flash_addr) {
+    _flash_addr = flash_addr;
+    memset(&_param, 0, sizeof(_param));
+}
+
+/**
+ * @brief   获取参数 (RAM 副本)
+ * @param   None
+ * @retval  param_t* 参数
+ */
+param_t* s_param_get(void) {
+    return &_param;
+}
+
+/**
+ * @brief   从 Flash 加载参数
+ * @param   None
+ * @retval  bool true:记录有效并已加载, false:无有效记录 (参数保持默认)
+ */
+bool s_param_load(void) {
+    param_hdr_t hdr;
+    flash_read(_flash_addr, &hdr, sizeof(hdr));
+
+    if(hdr.magic != PARAM_MAGIC) return false;
+    if(hdr.size == 0 || hdr.size > FLASH_PAGE_BYTES - sizeof(hdr)) return false;
+
+    const void* body = (const void*)(_flash_addr + sizeof(hdr));
+    if(_crc32(body, hdr.size) != hdr.crc) return false;
+
+    /* 记录比当前结构短: 只覆盖已保存部分; 比当前结构长: 多余部分忽略 */
+    uint32_t n = hdr.size < sizeof(_param) ? hdr.size : sizeof(_param);
+    memset(&_param, 0, sizeof(_param));
+    flash_read(_flash_addr + sizeof(hdr), &_param, n);
+    return true;
+}
+
+/**
+ * @brief   保存参数到 Flash
+ * @param   None
+ * @retval  bool true:成功, false:失败
+ * @note    会擦除整页, 仅在电机停止时调用
+ */
+bool s_param_save(void) {
+    param_hdr_t hdr;
+    hdr.magic = PARAM_MAGIC;
+    hdr.size = sizeof(_param);
+    hdr.crc = _crc32(&_param, sizeof(_param));
+
+    if(!flash_erase_page(_flash_addr)) return false;
+    if(!flash_write(_flash_addr + sizeof(hdr), &_param, sizeof(_param))) return false;
+    /* 头最后写入, 中途掉电时记录无效而不是错误 */
+    return flash_write(_flash_addr, &hdr, sizeof(hdr));
+}
+
+// ! ========================= 私 有 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   CRC32 (IEEE 802.3, 逐位计算)
+ * @param   data 数据
+ * @param   len 字节数
+ * @retval  uint32_t CRC
+ */
+static uint32_t _crc32(const void* data, uint32_t len) {
+    const uint8_t* p = (const uint8_t*)data;
+    uint32_t crc = 0xFFFFFFFFu;
+    while(len--) {
+        crc ^= *p++;
+        for(uint8_t i = 0; i < 8; ++i) {
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+        }
+    }
+    return ~crc;
+}
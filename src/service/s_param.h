@@ -0,0 +1,71 @@
+/**
+ * @file    s_param.h
+ * @brief   掉电保存参数服务 (片内 Flash 最后一页)
+ * @note    记录格式: 头 (magic, size, crc32) + param_t 前 size 字节.
+ *          新字段只允许追加在 param_t 末尾并分配新的 PARAM_VALID_xxx 位:
+ *          旧固件保存的记录较短, 加载时缺失字段保持默认值且有效位为 0
+ *
+ *          -------- 用法 --------
+ *          s_param_init(PARAM_FLASH_ADDR);
+ *          if(s_param_load() && (s_param_get()->valid & PARAM_VALID_ENC_SCALE)) { ... }
+ *          s_param_get()->enc_ppm_up = 15.5f;
+ *          s_param_get()->valid |= PARAM_VALID_ENC_SCALE;
+ *          s_param_save();
+ */
+#ifndef _s_param_h_
+#define _s_param_h_
+
+#include "s_lift_ff.h"
+#include "s_lift_gains.h"
+#include "s_lift_ident.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// ! ========================= 接 口 变 量 / Typedef 声 明 ========================= ! //
+
+// 参数有效位 (按位组合)
+#define PARAM_VALID_ENC_SCALE   (1u << 0)   // 编码器标定
+#define PARAM_VALID_LIMITS      (1u << 1)   // 软限位
+#define PARAM_VALID_PID_GAINS   (1u << 2)   // 位置 PID 增益 (自整定)
+#define PARAM_VALID_GAIN_TABLE  (1u << 3)   // 位置 PID 增益调度表
+#define PARAM_VALID_SMITH_MODEL (1u << 4)   // 纯滞后补偿模型 (阶跃辨识)
+#define PARAM_VALID_FF_MODEL    (1u << 5)   // 前馈模型 (匀速试验辨识)
+
+/**
+ * @brief 掉电保存参数
+ */
+typedef struct {
+    uint32_t valid;                 // 有效字段位图, PARAM_VALID_xxx 按位或
+
+    /* 编码器标定 */
+    float enc_ppm_up;               // 上行每毫米脉冲数
+    float enc_ppm_down;             // 下行每毫米脉冲数
+
+    /* 软限位 */
+    float limit_min_mm;
+    float limit_max_mm;
+
+    /* 位置 PID 增益 */
+    float pid_kp;
+    float pid_ki;
+    float pid_kd;
+
+    /* 位置 PID 增益调度表 */
+    lift_gain_table_t gain_table;
+
+    /* 纯滞后补偿模型 */
+    lift_fopdt_t smith_model;
+
+    /* 重力 / 摩擦前馈模型 */
+    lift_ff_model_t ff_model;
+} param_t;
+
+// ! ========================= 接 口 函 数 声 明 ========================= ! //
+
+void s_param_init(uint32_t flash_addr);
+param_t* s_param_get(void);
+bool s_param_load(void);
+bool s_param_save(void);
+
+#endif
@@ -3,6 +3,7 @@
  * @brief   PID 控制器实现
  */
 #include "s_pid.h"
+#include "s_pid_kernel.h"
 
 // ! ========================= 变 量 声 明 ========================= ! //
 
@@ -10,17 +11,16 @@
 
 // ! ========================= 私 有 函 数 声 明 ========================= ! //
 
-#define PID_ABS(x)              ((x) >= 0.0f ? (x) : -(x))
-#define PID_CLAMP(v, lo, hi)    ((v) > (hi) ? (hi) : ((v) < (lo) ? (lo) : (v)))
-
 static void _init(PID* pid, uint8_t mode, uint8_t features);
 static void _init_cfg(PID* pid, const pid_cfg_t* cfg);
 static void _set_gains(PID* pid, float kp, float ki, float kd);
 static void _set_params(PID* pid, float max_out, float integral_separation,
     float dead_band, float diff_filter_alpha, float output_max_rate);
 static void _set_feedforward(PID* pid, float ff_value);
+static void _set_weights(PID* pid, float b, float c);
 static float _calculate(PID* pid, float target, float actual, float dt_s);
 static void _reset(PID* pid);
+static void _track(PID* pid, float output, float target, float actual);
 
 // ! ========================= 接 口 函 数 实 现 ========================= ! //
 
@@ -36,8 +36,10 @@ PID pid_create(void) {
     pid.set_gains = _set_gains;
     pid.set_params = _set_params;
     pid.set_feedforward = _set_feedforward;
+    pid.set_weights = _set_weights;
     pid.calculate = _calculate;
     pid.reset = _reset;
+    pid.track = _track;
 
     return pid;
 }
@@ -62,6 +64,9 @@ static void _init(PID* pid, uint8_t mode, uint8_t features) {
     pid->diff_filter_alpha_ = 0.0f;
     pid->output_max_rate_ = 0.0f;
     pid->ff_value_ = 0.0f;
+    pid->sp_weight_b_ = 1.0f;
+    pid->sp_weight_c_ = 0.0f;
+    pid->diff_filter_tf_ = 0.0f;
 
     pid->output_ = 0.0f;
     pid->integral_ = 0.0f;
@@ -87,6 +92,11 @@ static void _init_cfg(PID* pid, const pid_cfg_t* cfg) {
     pid->dead_band_ = cfg->dead_band;
     pid->diff_filter_alpha_ = cfg->diff_filter_alpha;
     pid->output_max_rate_ = cfg->output_max_rate;
+    pid->diff_filter_tf_ = cfg->diff_filter_tf;
+    if(cfg->mode & PID_MODE_2DOF) {
+        pid->sp_weight_b_ = cfg->setpoint_weight_b;
+        pid->sp_weight_c_ = cfg->setpoint_weight_c;
+    }
 }
 
 /**
@@ -117,6 +127,14 @@ static void _set_feedforward(PID* pid, float ff_value) {
     pid->ff_value_ = ff_value;
 }
 
+/**
+ * @brief   设置二自由度设定值权重
+ */
+static void _set_weights(PID* pid, float b, float c) {
+    pid->sp_weight_b_ = b;
+    pid->sp_weight_c_ = c;
+}
+
 /**
  * @brief   计算 PID 输出
  * @param   pid    PID 实例指针
@@ -124,112 +142,13 @@ static void _set_feedforward(PID* pid, float ff_value) {
  * @param   actual 实际值
  * @param   dt_s   时间间隔 (秒); 0 时积分离散累加, 微分项不计算
  * @return  PID 输出值
+ * @note    动态版本: 每次按实例的 mode_ / features_ 判断各阶段, 计算体见 s_pid_kernel.h
  */
 float _calculate(PID* pid, float target, float actual, float dt_s) {
-    float err = target - actual;
     uint8_t feat = pid->features_;
     uint8_t mode = pid->mode_;
 
-    /* 死区 */
-    if((feat & PID_FEAT_DEADBAND) && PID_ABS(err) < pid->dead_band_) {
-        err = 0.0f;
-    }
-
-    float out = 0.0f;
-
-    /* 比例项 */
-    if(mode & PID_MODE_P) {
-        out += pid->kp_ * err;
-    }
-
-    /* 积分项 */
-    if(mode & PID_MODE_I) {
-        uint8_t allow_integral = 1;
-        uint8_t allow_separation = 0;
-
-        /* 积分抗饱和 : 条件积分法 (输出饱和且误差同向时禁止积分) */
-        if(feat & PID_FEAT_ANTI_WINDUP) {
-            if(pid->_prev_output_ >= pid->max_out_ && err > 0.0f) allow_integral = 0;
-            if(pid->_prev_output_ <= -pid->max_out_ && err < 0.0f) allow_integral = 0;
-        }
-
-        if(allow_integral) {
-            pid->integral_ += (dt_s > 0.0f) ? (err * dt_s) : err;
-        }
-
-        /* 积分分离 (误差过大时不叠加积分输出) */
-        if(feat & PID_FEAT_INTEGRAL_SEP) {
-            if(PID_ABS(err) > pid->integral_separation_) {
-                allow_separation = 1;
-            }
-        }
-
-        if(!allow_separation) {
-            out += pid->ki_ * pid->integral_;
-        }
-    }
-
-    /* 微分项 */
-    if(mode & PID_MODE_D) {
-        float diff;
-
-        /* 微分先行: 基于测量值变化率, 避免目标突变时 D 项跳变 */
-        if(feat & PID_FEAT_DIFF_ON_MEAS) {
-            diff = (dt_s > 0.0f) ? (-(actual - pid->_prev_measurement_) / dt_s) : 0.0f;
-            pid->_prev_measurement_ = actual;
-        }
-        else {
-            diff = (dt_s > 0.0f) ? ((err - pid->prev_err_) / dt_s) : 0.0f;
-            pid->prev_err_ = err;
-        }
-
-        /* 微分滤波: 一阶低通 */
-        if(feat & PID_FEAT_DIFF_FILTER) {
-            diff = pid->diff_filter_alpha_ * diff
-                + (1.0f - pid->diff_filter_alpha_) * pid->_filtered_diff_;
-            pid->_filtered_diff_ = diff;
-        }
-
-        out += pid->kd_ * diff;
-    }
-
-    /* 前馈 */
-    if(feat & PID_FEAT_FEEDFORWARD) {
-        out += pid->ff_value_;
-    }
-
-    /* 保存未限幅输出, 用于反计算法抗饱和 */
-    float total_output = out;
-
-    /* 输出限幅 */
-    if(feat & PID_FEAT_OUTPUT_LIMIT) {
-        out = PID_CLAMP(out, -pid->max_out_, pid->max_out_);
-    }
-
-    /* 输出变化率限制 */
-    if(feat & PID_FEAT_OUTPUT_RATE_LIMIT) {
-        if(dt_s > 0.0f) {
-            float max_change = pid->output_max_rate_ * dt_s;
-            float delta = out - pid->_prev_output_;
-            if(PID_ABS(delta) > max_change) {
-                out = pid->_prev_output_ + (delta > 0.0f ? max_change : -max_change);
-            }
-        }
-    }
-
-    /* 积分抗饱和 : 反计算法 (back-calculation) */
-    if((mode & PID_MODE_I) && (feat & PID_FEAT_ANTI_WINDUP) && (feat & PID_FEAT_OUTPUT_LIMIT)) {
-        float output_diff = total_output - out;
-        if(PID_ABS(pid->kp_) > 1e-6f && PID_ABS(pid->ki_) > 1e-6f) {
-            float Kb = pid->ki_ / pid->kp_;  /* Kb = 1/Tt = Ki/Kp */
-            pid->integral_ -= output_diff * Kb * dt_s;
-        }
-    }
-
-    pid->output_ = out;
-    pid->_prev_output_ = out;
-
-    return out;
+    PID_KERNEL_BODY(mode, feat)
 }
 
 /**
@@ -243,3 +162,44 @@ void _reset(PID* pid) {
     pid->_prev_output_ = 0.0f;
     pid->_prev_measurement_ = 0.0f;
 }
+
+/**
+ * @brief   输出跟踪 (无扰切换)
+ * @param   pid    PID 实例指针
+ * @param   output 当前实际施加的输出
+ * @param   target 当前目标值
+ * @param   actual 当前实际值
+ * @note    增量式: 累计输出直接取 output; 位置式: 反算积分使 P + I + 前馈 = output
+ *          (无积分项时无法跟踪; 二自由度时 P 按 b·r - y 计算). 微分历史从当前值重新开始, 不计入被跟踪的输出:
+ *          运动中切换时若把当前微分项也算进去, 停止后它会变成只能靠积分消除的偏置
+ */
+static void _track(PID* pid, float output, float target, float actual) {
+    float err = target - actual;
+    if((pid->features_ & PID_FEAT_DEADBAND) && PID_ABS(err) < pid->dead_band_) {
+        err = 0.0f;
+    }
+
+    float ep = err;
+    float ed = actual;
+    if(pid->mode_ & PID_MODE_2DOF) {
+        ep -= (1.0f - pid->sp_weight_b_) * target;
+        ed = pid->sp_weight_c_ * target - actual;
+    }
+
+    float base = (pid->features_ & PID_FEAT_FEEDFORWARD) ? pid->ff_value_ : 0.0f;
+
+    if(pid->mode_ & PID_MODE_INCREMENTAL) {
+        pid->integral_ = output - base;
+    }
+    else if((pid->mode_ & PID_MODE_I) && PID_ABS(pid->ki_) > 1e-6f) {
+        if(pid->mode_ & PID_MODE_P) base += pid->kp_ * ep;
+        pid->integral_ = (output - base) / pid->ki_;
+    }
+
+    /* 增量式的 prev_err_ 为比例项输入; 二自由度的微分历史为 c·r - y, 否则为测量值 */
+    pid->prev_err_ = (pid->mode_ & PID_MODE_INCREMENTAL) ? ep : err;
+    pid->_prev_measurement_ = ed;
+    pid->_filtered_diff_ = 0.0f;
+    pid->_prev_output_ = output;
+    pid->output_ = output;
+}
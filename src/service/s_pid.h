@@ -24,6 +24,26 @@
  *          PID_t pid = pid_create();
  *          pid.init_cfg(&pid, &cfg);
  *          float out = pid.calculate(&pid, target, actual, dt_s);
+ *
+ *          -------- 增量式 (PID_MODE_INCREMENTAL) --------
+ *          每周期计算 Δu = kp·Δe + ki·e·dt + kd·Δd, 输出 u = u[k-1] + Δu;
+ *          integral_ 保存累计的反馈输出 (不随限幅回写, 以免截去比例项); 开启输出限幅时
+ *          输出饱和且误差同向即不累加积分增量, 不会积分饱和 (PID_FEAT_ANTI_WINDUP 不起作用);
+ *          各项都作用在增量上, 运行中修改增益输出不跳变.
+ *          手动 -> 自动切换时调用 track 以当前手动输出初始化, 切换无扰动 (位置式同样适用).
+ *          仅浮点版支持, 定点版 / 多路版忽略该位按位置式计算
+ *
+ *          -------- 二自由度 (PID_MODE_2DOF) --------
+ *          比例与微分作用于加权设定值, 积分仍作用于误差:
+ *              u = kp·(b·r - y) + ki·∫(r - y)dt + kd·d(c·r - y)/dt
+ *          b < 1 减小设定值阶跃时的比例冲击 (饱和与超调), 扰动响应由 kp / ki 单独决定;
+ *          c = 0 即微分先行 (此时 PID_FEAT_DIFF_ON_MEAS 不起作用), c = 1 为误差微分.
+ *          位置式下稳态时积分需承担 kp·(1 - b)·r (积分分离会使其无法建立), 设定值远离 0 时
+ *          宜配合增量式使用 (增量式只对设定值的变化加权). 仅浮点版支持
+ *
+ *          -------- 微分滤波时间常数 --------
+ *          配置 diff_filter_tf > 0 时按 alpha = dt / (Tf + dt) 逐次计算滤波系数,
+ *          滤波截止频率不随实际周期变化; 为 0 时使用固定的 diff_filter_alpha
  */
 #ifndef _s_pid_h_
 #define _s_pid_h_
@@ -40,6 +60,8 @@
 #define PID_MODE_PI     0x06u   // 0b110
 #define PID_MODE_PD     0x05u   // 0b101
 #define PID_MODE_PID    0x07u   // 0b111
+#define PID_MODE_INCREMENTAL 0x08u  // 增量式 (速度型): 与上面按位或, 如 PID_MODE_PID | PID_MODE_INCREMENTAL
+#define PID_MODE_2DOF   0x10u   // 二自由度 (设定值加权): 与上面按位或
 
 // PID 功能特性 (按位组合) 
 #define PID_FEAT_NONE               0x00u
@@ -67,6 +89,9 @@ typedef struct {
     float dead_band;                // 死区阈值
     float diff_filter_alpha;        // 微分滤波系数 (0~1)
     float output_max_rate;          // 输出最大变化率         
+    float setpoint_weight_b;        // 比例设定值权重 b (PID_MODE_2DOF)
+    float setpoint_weight_c;        // 微分设定值权重 c (PID_MODE_2DOF)
+    float diff_filter_tf;           // 微分滤波时间常数 (秒), 0 = 使用 diff_filter_alpha
 } pid_cfg_t;
 
 /**
@@ -88,10 +113,13 @@ struct PID {
     float diff_filter_alpha_;       // 微分滤波系数
     float output_max_rate_;         // 输出最大变化率
     float ff_value_;                // 前馈值
+    float sp_weight_b_;             // 比例设定值权重
+    float sp_weight_c_;             // 微分设定值权重
+    float diff_filter_tf_;          // 微分滤波时间常数
 
     float output_;                  // 当前输出
-    float integral_;                // 积分累积值
-    float prev_err_;                // 上一次误差
+    float integral_;                // 积分累积值 (增量式: 累计反馈输出)
+    float prev_err_;                // 上一次误差 (二自由度增量式: 上一次 b·r - y)
 
     /**
      * @brief   构造函数 (初始化函数指针)
@@ -131,6 +159,13 @@ struct PID {
      * @param   ff_value 前馈值
      */
     void(*set_feedforward)(PID* pid, float ff_value);
+    /**
+     * @brief   设置二自由度设定值权重
+     * @param   pid PID 实例指针
+     * @param   b   比例设定值权重
+     * @param   c   微分设定值权重
+     */
+    void(*set_weights)(PID* pid, float b, float c);
     /**
      * @brief   计算 PID 输出
      * @param   pid    PID 实例指针
@@ -145,11 +180,19 @@ struct PID {
      * @param   pid PID 实例指针
      */
     void(*reset)(PID* pid);
+    /**
+     * @brief   输出跟踪 (无扰切换): 使下一次计算从给定输出继续
+     * @param   pid    PID 实例指针
+     * @param   output 当前实际施加的输出 (如手动输出)
+     * @param   target 当前目标值
+     * @param   actual 当前实际值
+     */
+    void(*track)(PID* pid, float output, float target, float actual);
 
 // private:
     float _filtered_diff_;
     float _prev_output_;
-    float _prev_measurement_;
+    float _prev_measurement_;       // 上一次测量值 (二自由度: 上一次 c·r - y)
 };
 
 // ! ========================= 接 口 函 数 声 明 ========================= ! //
@@ -0,0 +1,200 @@
+/**
+ * @file    s_pid_bank.c
+ * @brief   多路 PID 批量计算实现
+ */
+#include "s_pid_bank.h"
+#include "s_pid_kernel.h"
+
+// ! ========================= 变 量 声 明 ========================= ! //
+
+
+
+// ! ========================= 私 有 函 数 声 明 ========================= ! //
+
+static void _init(PIDBank* bank, uint8_t count, const pid_cfg_t* cfg);
+static void _set_gains(PIDBank* bank, uint8_t idx, float kp, float ki, float kd);
+static void _set_feedforward(PIDBank* bank, uint8_t idx, float ff_value);
+static const float* _update(PIDBank* bank, const float* target, const float* actual, float dt_s);
+static void _reset(PIDBank* bank, uint8_t idx);
+
+// ! ========================= 接 口 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   创建多路 PID 实例 (原地构造)
+ * @param   bank 实例指针
+ * @retval  None
+ * @note    对象较大, 按值返回会在 1 KB 的栈上产生同样大小的临时副本
+ */
+void pid_bank_create(PIDBank* bank) {
+    bank->count_ = 0;
+    bank->init = _init;
+    bank->set_gains = _set_gains;
+    bank->set_feedforward = _set_feedforward;
+    bank->update = _update;
+    bank->reset = _reset;
+}
+
+// ! ========================= 私 有 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   初始化 (全部通道使用同一配置表)
+ */
+static void _init(PIDBank* bank, uint8_t count, const pid_cfg_t* cfg) {
+    if(count > PID_BANK_MAX) count = PID_BANK_MAX;
+
+    bank->count_ = count;
+    bank->mode_ = cfg->mode;
+    bank->features_ = cfg->features;
+
+    for(uint8_t i = 0; i < count; ++i) {
+        bank->kp_[i] = cfg->kp;
+        bank->ki_[i] = cfg->ki;
+        bank->kd_[i] = cfg->kd;
+        bank->max_out_[i] = cfg->max_out;
+        bank->integral_separation_[i] = cfg->integral_separation;
+        bank->dead_band_[i] = cfg->dead_band;
+        bank->diff_filter_alpha_[i] = cfg->diff_filter_alpha;
+        bank->output_max_rate_[i] = cfg->output_max_rate;
+        bank->ff_value_[i] = 0.0f;
+        _reset(bank, i);
+    }
+}
+
+/**
+ * @brief   设置单个通道的增益
+ */
+static void _set_gains(PIDBank* bank, uint8_t idx, float kp, float ki, float kd) {
+    if(idx >= bank->count_) return;
+    bank->kp_[idx] = kp;
+    bank->ki_[idx] = ki;
+    bank->kd_[idx] = kd;
+}
+
+/**
+ * @brief   设置单个通道的前馈值
+ */
+static void _set_feedforward(PIDBank* bank, uint8_t idx, float ff_value) {
+    if(idx >= bank->count_) return;
+    bank->ff_value_[idx] = ff_value;
+}
+
+/**
+ * @brief   计算全部通道
+ * @param   bank   实例指针
+ * @param   target 目标值数组
+ * @param   actual 实际值数组
+ * @param   dt_s   时间间隔 (秒)
+ * @return  输出数组
+ * @note    单个循环依次处理各通道, 特性位与 dt 相关的量在循环外取出一次;
+ *          各通道的运算顺序与 PID::calculate 相同
+ */
+static const float* _update(PIDBank* bank, const float* target, const float* actual, float dt_s) {
+    uint8_t n = bank->count_;
+    uint8_t feat = bank->features_;
+    uint8_t mode = bank->mode_;
+    uint8_t has_dt = (dt_s > 0.0f);
+    uint8_t back_calc = (mode & PID_MODE_I) && (feat & PID_FEAT_ANTI_WINDUP) && (feat & PID_FEAT_OUTPUT_LIMIT);
+
+    for(uint8_t i = 0; i < n; ++i) {
+        float err = target[i] - actual[i];
+
+        /* 死区 */
+        if((feat & PID_FEAT_DEADBAND) && PID_ABS(err) < bank->dead_band_[i]) {
+            err = 0.0f;
+        }
+
+        float out = 0.0f;
+
+        /* 比例项 */
+        if(mode & PID_MODE_P) {
+            out += bank->kp_[i] * err;
+        }
+
+        /* 积分项 */
+        if(mode & PID_MODE_I) {
+            uint8_t allow_integral = 1;
+
+            /* 积分抗饱和 : 条件积分法 */
+            if(feat & PID_FEAT_ANTI_WINDUP) {
+                if(bank->_prev_output_[i] >= bank->max_out_[i] && err > 0.0f) allow_integral = 0;
+                if(bank->_prev_output_[i] <= -bank->max_out_[i] && err < 0.0f) allow_integral = 0;
+            }
+
+            if(allow_integral) {
+                bank->integral_[i] += has_dt ? (err * dt_s) : err;
+            }
+
+            /* 积分分离 */
+            if(!((feat & PID_FEAT_INTEGRAL_SEP) && PID_ABS(err) > bank->integral_separation_[i])) {
+                out += bank->ki_[i] * bank->integral_[i];
+            }
+        }
+
+        /* 微分项 */
+        if(mode & PID_MODE_D) {
+            float diff;
+
+            if(feat & PID_FEAT_DIFF_ON_MEAS) {
+                diff = has_dt ? (-(actual[i] - bank->_prev_measurement_[i]) / dt_s) : 0.0f;
+                bank->_prev_measurement_[i] = actual[i];
+            }
+            else {
+                diff = has_dt ? ((err - bank->prev_err_[i]) / dt_s) : 0.0f;
+                bank->prev_err_[i] = err;
+            }
+
+            if(feat & PID_FEAT_DIFF_FILTER) {
+                diff = bank->diff_filter_alpha_[i] * diff
+                    + (1.0f - bank->diff_filter_alpha_[i]) * bank->_filtered_diff_[i];
+                bank->_filtered_diff_[i] = diff;
+            }
+
+            out += bank->kd_[i] * diff;
+        }
+
+        /* 前馈 */
+        if(feat & PID_FEAT_FEEDFORWARD) {
+            out += bank->ff_value_[i];
+        }
+
+        float total_output = out;
+
+        /* 输出限幅 */
+        if(feat & PID_FEAT_OUTPUT_LIMIT) {
+            out = PID_CLAMP(out, -bank->max_out_[i], bank->max_out_[i]);
+        }
+
+        /* 输出变化率限制 */
+        if((feat & PID_FEAT_OUTPUT_RATE_LIMIT) && has_dt) {
+            float max_change = bank->output_max_rate_[i] * dt_s;
+            float delta = out - bank->_prev_output_[i];
+            if(PID_ABS(delta) > max_change) {
+                out = bank->_prev_output_[i] + (delta > 0.0f ? max_change : -max_change);
+            }
+        }
+
+        /* 积分抗饱和 : 反计算法 */
+        if(back_calc && PID_ABS(bank->kp_[i]) > 1e-6f && PID_ABS(bank->ki_[i]) > 1e-6f) {
+            float Kb = bank->ki_[i] / bank->kp_[i];
+            bank->integral_[i] -= (total_output - out) * Kb * dt_s;
+        }
+
+        bank->output_[i] = out;
+        bank->_prev_output_[i] = out;
+    }
+
+    return bank->output_;
+}
+
+/**
+ * @brief   重置单个通道的状态 (不改变参数)
+ */
+static void _reset(PIDBank* bank, uint8_t idx) {
+    if(idx >= PID_BANK_MAX) return;
+    bank->output_[idx] = 0.0f;
+    bank->integral_[idx] = 0.0f;
+    bank->prev_err_[idx] = 0.0f;
+    bank->_filtered_diff_[idx] = 0.0f;
+    bank->_prev_output_[idx] = 0.0f;
+    bank->_prev_measurement_[idx] = 0.0f;
+}
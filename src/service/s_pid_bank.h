@@ -0,0 +1,105 @@
+/**
+ * @file    s_pid_bank.h
+ * @brief   多路 PID 批量计算 (结构体数组 -> 数组结构体)
+ *          一组模式 / 特性相同的控制器共用一个对象: 增益与状态按字段存放在连续数组中,
+ *          函数指针只保存一份, 每个控制周期调用一次 update 完成全部通道
+ * @note    与 PID 对象相比:
+ *          - 每通道只占 15 个 float (参数 9 + 状态 6), 不再附带 9 个函数指针
+ *          - 一次调用处理全部通道, 循环内无间接调用, 特性位与 dt 判断在循环外取出
+ *          - 计算顺序与 PID::calculate 逐项相同, 输出一致
+ *          - 只有位置式: PID_MODE_INCREMENTAL / PID_MODE_2DOF 与 diff_filter_tf 被忽略
+ *
+ *          -------- 用法 --------
+ *          static PIDBank bank;
+ *          pid_bank_create(&bank);                    // 对象约 500 字节, 原地构造, 不按值返回
+ *          bank.init(&bank, 3, &cfg);                  // 3 路共用配置表 (含模式与特性)
+ *          bank.set_gains(&bank, 1, 0.3f, 0.0f, 0.0f);  // 可按通道单独调参
+ *          bank.update(&bank, targets, actuals, dt_s); // 结果在 bank.output_[i]
+ */
+#ifndef _s_pid_bank_h_
+#define _s_pid_bank_h_
+
+#include "s_pid.h"
+
+#include <stdint.h>
+
+// ! ========================= 接 口 变 量 / Typedef 声 明 ========================= ! //
+
+// 单个对象的最大通道数
+#define PID_BANK_MAX    8
+
+/**
+ * @brief 多路 PID 类
+ */
+typedef struct PIDBank PIDBank;
+struct PIDBank {
+// public:
+    uint8_t count_;                                 // 通道数
+    uint8_t mode_;                                  // PID 模式 (全部通道)
+    uint8_t features_;                              // 功能特性 (全部通道)
+
+    float kp_[PID_BANK_MAX];
+    float ki_[PID_BANK_MAX];
+    float kd_[PID_BANK_MAX];
+
+    float max_out_[PID_BANK_MAX];                   // 最大输出值
+    float integral_separation_[PID_BANK_MAX];       // 积分分离阈值
+    float dead_band_[PID_BANK_MAX];                 // 死区阈值
+    float diff_filter_alpha_[PID_BANK_MAX];         // 微分滤波系数
+    float output_max_rate_[PID_BANK_MAX];           // 输出最大变化率
+    float ff_value_[PID_BANK_MAX];                  // 前馈值
+
+    float output_[PID_BANK_MAX];                    // 当前输出
+    float integral_[PID_BANK_MAX];                  // 积分累积值
+    float prev_err_[PID_BANK_MAX];                  // 上一次误差
+
+    /**
+     * @brief   初始化 (全部通道使用同一配置表)
+     * @param   bank  实例指针
+     * @param   count 通道数 (1 ~ PID_BANK_MAX)
+     * @param   cfg   配置结构体指针
+     */
+    void(*init)(PIDBank* bank, uint8_t count, const pid_cfg_t* cfg);
+    /**
+     * @brief   设置单个通道的增益
+     * @param   bank 实例指针
+     * @param   idx  通道号
+     * @param   kp   比例系数
+     * @param   ki   积分系数
+     * @param   kd   微分系数
+     */
+    void(*set_gains)(PIDBank* bank, uint8_t idx, float kp, float ki, float kd);
+    /**
+     * @brief   设置单个通道的前馈值
+     * @param   bank     实例指针
+     * @param   idx      通道号
+     * @param   ff_value 前馈值
+     */
+    void(*set_feedforward)(PIDBank* bank, uint8_t idx, float ff_value);
+    /**
+     * @brief   计算全部通道
+     * @param   bank   实例指针
+     * @param   target 目标值数组 (count_ 个)
+     * @param   actual 实际值数组 (count_ 个)
+     * @param   dt_s   时间间隔 (秒); 0 时积分离散累加, 微分项不计算
+     * @return  输出数组 (即 output_)
+     */
+    const float*(*update)(PIDBank* bank, const float* target, const float* actual, float dt_s);
+    /**
+     * @brief   重置单个通道的状态 (不改变参数)
+     * @param   bank 实例指针
+     * @param   idx  通道号
+     */
+    void(*reset)(PIDBank* bank, uint8_t idx);
+
+// private:
+    float _filtered_diff_[PID_BANK_MAX];
+    float _prev_output_[PID_BANK_MAX];
+    float _prev_measurement_[PID_BANK_MAX];
+};
+
+// ! ========================= 接 口 函 数 声 明 ========================= ! //
+
+void pid_bank_create(PIDBank* bank);
+
+#endif
@@ -0,0 +1,459 @@
+/**
+ * @file    s_pid_bench.c
+ * @brief   PID 实现对比测试服务实现
+ */
+#include "s_pid_bench.h"
+#include "s_pid_q16.h"
+#include "s_pid_kernel.h"
+#include "s_pid_bank.h"
+#include "s_bench.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+// ! ========================= 变 量 声 明 ========================= ! //
+
+static const pid_cfg_t* _cfg = 0;
+static const pid_bench_plant_t* _plant;
+static float _dt_s;
+
+static bench_t _bench_float;
+static bench_t _bench_q16;
+static bench_t _bench_static;
+static bench_t _bench_bank;
+static PIDBank _bank;
+static PID _pids[PID_BANK_MAX];     // 与 _bank 对比的逐个计算对象 (放在栈上过大)
+
+/**
+ * @brief 挂起的命令
+ */
+typedef enum {
+    PidBenchReqNone = 0,
+    PidBenchReqRun,                 // $PID_BENCH#
+    PidBenchReqKernel,              // $PID_BENCH_KERNEL#
+    PidBenchReqBank,                // $PID_BENCH_BANK#
+    PidBenchReq2dof                 // $PID_BENCH_2DOF[:b,c,tf]#
+} PidBenchReq_e;
+
+static PidBenchReq_e _req = PidBenchReqNone;
+static float _req_args[3];
+
+#define PID_BENCH_FEAT_PI   (PID_FEAT_OUTPUT_LIMIT | PID_FEAT_ANTI_WINDUP)
+#define PID_BENCH_FEAT_PID  (PID_BENCH_FEAT_PI | PID_FEAT_DIFF_FILTER)
+#define PID_BENCH_FEAT_LIFT (PID_BENCH_FEAT_PID | PID_FEAT_INTEGRAL_SEP | PID_FEAT_DEADBAND | PID_FEAT_DIFF_ON_MEAS)
+
+PID_DEFINE(_kernel_p, PID_MODE_P, PID_FEAT_NONE)
+PID_DEFINE(_kernel_pi, PID_MODE_PI, PID_BENCH_FEAT_PI)
+PID_DEFINE(_kernel_pid, PID_MODE_PID, PID_BENCH_FEAT_PID)
+PID_DEFINE(_kernel_lift, PID_MODE_PID, PID_BENCH_FEAT_LIFT)
+
+/**
+ * @brief 特化核对比配置表
+ */
+static const struct {
+    uint8_t mode;
+    uint8_t features;
+    float(*kernel)(PID* pid, float target, float actual, float dt_s);
+} _kernels[PidKernelCount] = {
+    { PID_MODE_P,   PID_FEAT_NONE,       _kernel_p },
+    { PID_MODE_PI,  PID_BENCH_FEAT_PI,   _kernel_pi },
+    { PID_MODE_PID, PID_BENCH_FEAT_PID,  _kernel_pid },
+    { PID_MODE_PID, PID_BENCH_FEAT_LIFT, _kernel_lift },
+};
+
+// ! ========================= 私 有 函 数 声 明 ========================= ! //
+
+static void _plant_step(float* pos, float* vel, float u, float load);
+static void _report_2dof(float b, float c, float tf_s);
+
+// ! ========================= 接 口 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   初始化对比测试 (需在 s_bench_init 之后调用)
+ * @param   cfg PID 配置表 (两种实现共用)
+ * @param   plant 仿真对象参数
+ * @param   dt_s 控制周期
+ * @retval  None
+ */
+void s_pid_bench_init(const pid_cfg_t* cfg, const pid_bench_plant_t* plant, float dt_s) {
+    _cfg = cfg;
+    _plant = plant;
+    _dt_s = dt_s;
+    s_bench_register(&_bench_float, "pid_float");
+    s_bench_register(&_bench_q16, "pid_q16");
+    s_bench_register(&_bench_static, "pid_static");
+    s_bench_register(&_bench_bank, "pid_bank");
+}
+
+/**
+ * @brief   运行一次阶跃响应对比
+ * @param   step_mm 阶跃幅度
+ * @param   steps 控制周期数
+ * @param   out 结果输出
+ * @retval  None
+ */
+void s_pid_bench_run(float step_mm, uint16_t steps, pid_bench_result_t* out) {
+    out->cyc_float = 0;
+    out->cyc_q16 = 0;
+    out->max_du = 0.0f;
+    out->max_dpos_mm = 0.0f;
+    out->err_float_mm = step_mm;
+    out->err_q16_mm = step_mm;
+    if(!_cfg || steps == 0) return;
+
+    /* 定点版只有位置式, 浮点参考同样按位置式计算 */
+    pid_cfg_t cfg = *_cfg;
+    cfg.mode &= (uint8_t)~PID_MODE_INCREMENTAL;
+
+    PID pf = pid_create();
+    PIDQ16 pq = pid_q16_create();
+    pf.init_cfg(&pf, &cfg);
+    pq.init_cfg(&pq, &cfg, _dt_s);
+
+    float pos_f = 0.0f, vel_f = 0.0f;
+    float pos_q = 0.0f, vel_q = 0.0f;
+    q16_t target_q = q16_from_float(step_mm);
+    uint64_t sum_f = 0, sum_q = 0;
+
+    for(uint16_t i = 0; i < steps; ++i) {
+        s_bench_begin(&_bench_float);
+        float u_f = pf.calculate(&pf, step_mm, pos_f, _dt_s);
+        s_bench_end(&_bench_float);
+        sum_f += _bench_float.last;
+
+        q16_t actual_q = q16_from_float(pos_q);
+        s_bench_begin(&_bench_q16);
+        q16_t u_q16 = pq.calculate(&pq, target_q, actual_q);
+        s_bench_end(&_bench_q16);
+        sum_q += _bench_q16.last;
+
+        float u_q = q16_to_float(u_q16);
+        float du = fabsf(u_f - u_q);
+        if(du > out->max_du) out->max_du = du;
+
+        _plant_step(&pos_f, &vel_f, u_f, 0.0f);
+        _plant_step(&pos_q, &vel_q, u_q, 0.0f);
+
+        float dpos = fabsf(pos_f - pos_q);
+        if(dpos > out->max_dpos_mm) out->max_dpos_mm = dpos;
+    }
+
+    out->cyc_float = (uint32_t)(sum_f / steps);
+    out->cyc_q16 = (uint32_t)(sum_q / steps);
+    out->err_float_mm = step_mm - pos_f;
+    out->err_q16_mm = step_mm - pos_q;
+}
+
+/**
+ * @brief   比较动态 calculate 与特化核 (同一配置, 各驱动一个仿真对象)
+ * @param   which 配置
+ * @param   step_mm 阶跃幅度
+ * @param   steps 控制周期数
+ * @param   out 结果输出
+ * @retval  None
+ */
+void s_pid_bench_kernel(PidKernel_e which, float step_mm, uint16_t steps, pid_kernel_result_t* out) {
+    out->cyc_dynamic = 0;
+    out->cyc_static = 0;
+    out->max_du = 0.0f;
+    if(!_cfg || which >= PidKernelCount || steps == 0) return;
+
+    pid_cfg_t cfg = *_cfg;
+    cfg.mode = _kernels[which].mode;
+    cfg.features = _kernels[which].features;
+
+    PID pd = pid_create();
+    PID ps = pid_create();
+    pd.init_cfg(&pd, &cfg);
+    ps.init_cfg(&ps, &cfg);
+    ps.calculate = _kernels[which].kernel;
+
+    float pos_d = 0.0f, vel_d = 0.0f;
+    float pos_s = 0.0f, vel_s = 0.0f;
+    uint64_t sum_d = 0, sum_s = 0;
+
+    for(uint16_t i = 0; i < steps; ++i) {
+        s_bench_begin(&_bench_float);
+        float u_d = pd.calculate(&pd, step_mm, pos_d, _dt_s);
+        s_bench_end(&_bench_float);
+        sum_d += _bench_float.last;
+
+        s_bench_begin(&_bench_static);
+        float u_s = ps.calculate(&ps, step_mm, pos_s, _dt_s);
+        s_bench_end(&_bench_static);
+        sum_s += _bench_static.last;
+
+        float du = fabsf(u_d - u_s);
+        if(du > out->max_du) out->max_du = du;
+
+        _plant_step(&pos_d, &vel_d, u_d, 0.0f);
+        _plant_step(&pos_s, &vel_s, u_s, 0.0f);
+    }
+
+    out->cyc_dynamic = (uint32_t)(sum_d / steps);
+    out->cyc_static = (uint32_t)(sum_s / steps);
+}
+
+/**
+ * @brief   比较 n 个 PID 对象逐个计算与 PIDBank 批量计算
+ * @param   n 通道数 (1 ~ PID_BANK_MAX)
+ * @param   step_mm 最大阶跃幅度 (第 i 通道为 step_mm·(i+1)/n)
+ * @param   steps 控制周期数
+ * @param   out 结果输出
+ * @retval  None
+ */
+void s_pid_bench_bank(uint8_t n, float step_mm, uint16_t steps, pid_bank_result_t* out) {
+    out->ram_struct = (uint16_t)sizeof(PID);
+    out->ram_bank = (uint16_t)(sizeof(PIDBank) / PID_BANK_MAX);
+    out->cyc_struct = 0;
+    out->cyc_bank = 0;
+    out->max_du = 0.0f;
+    if(n > PID_BANK_MAX) n = PID_BANK_MAX;
+    if(!_cfg || n == 0 || steps == 0) return;
+
+    float target[PID_BANK_MAX];
+    float pos_s[PID_BANK_MAX], vel_s[PID_BANK_MAX];
+    float pos_b[PID_BANK_MAX], vel_b[PID_BANK_MAX];
+    float u_s[PID_BANK_MAX];
+    uint64_t sum_s = 0, sum_b = 0;
+    uint8_t i;
+
+    /* 多路版只有位置式 */
+    pid_cfg_t cfg = *_cfg;
+    cfg.mode &= (uint8_t)~PID_MODE_INCREMENTAL;
+
+    pid_bank_create(&_bank);
+    _bank.init(&_bank, n, &cfg);
+    for(i = 0; i < n; ++i) {
+        _pids[i] = pid_create();
+        _pids[i].init_cfg(&_pids[i], &cfg);
+        target[i] = step_mm * (float)(i + 1) / (float)n;
+        pos_s[i] = vel_s[i] = pos_b[i] = vel_b[i] = 0.0f;
+    }
+
+    for(uint16_t k = 0; k < steps; ++k) {
+        s_bench_begin(&_bench_float);
+        for(i = 0; i < n; ++i) {
+            u_s[i] = _pids[i].calculate(&_pids[i], target[i], pos_s[i], _dt_s);
+        }
+        s_bench_end(&_bench_float);
+        sum_s += _bench_float.last;
+
+        s_bench_begin(&_bench_bank);
+        const float* u_b = _bank.update(&_bank, target, pos_b, _dt_s);
+        s_bench_end(&_bench_bank);
+        sum_b += _bench_bank.last;
+
+        for(i = 0; i < n; ++i) {
+            float du = fabsf(u_s[i] - u_b[i]);
+            if(du > out->max_du) out->max_du = du;
+            _plant_step(&pos_s[i], &vel_s[i], u_s[i], 0.0f);
+            _plant_step(&pos_b[i], &vel_b[i], u_b[i], 0.0f);
+        }
+    }
+
+    out->cyc_struct = (uint32_t)(sum_s / ((uint32_t)steps * n));
+    out->cyc_bank = (uint32_t)(sum_b / ((uint32_t)steps * n));
+}
+
+/**
+ * @brief   比较一自由度与二自由度 PID 的设定值响应与扰动响应
+ * @param   b 比例设定值权重
+ * @param   c 微分设定值权重
+ * @param   tf_s 微分滤波时间常数 (0 = 沿用配置表的滤波系数)
+ * @param   step_mm 阶跃幅度
+ * @param   steps 控制周期数 (第 steps/2 个周期加入扰动)
+ * @param   load 负载扰动 (等效占空比)
+ * @param   out 结果输出
+ * @retval  None
+ */
+void s_pid_bench_2dof(float b, float c, float tf_s, float step_mm, uint16_t steps, float load, pid_2dof_result_t* out) {
+    PID pid[2];
+    float pos[2] = { 0.0f, 0.0f }, vel[2] = { 0.0f, 0.0f };
+    float peak[2] = { 0.0f, 0.0f };
+    float t_out[2] = { 0.0f, 0.0f };
+    float pos_d[2] = { 0.0f, 0.0f };    // 扰动开始时的位置
+    uint8_t k;
+
+    for(k = 0; k < 2; ++k) {
+        out->overshoot_pct[k] = 0.0f;
+        out->settle_s[k] = -1.0f;
+        out->sat_s[k] = 0.0f;
+        out->dist_dev_mm[k] = 0.0f;
+        out->dist_settle_s[k] = -1.0f;
+    }
+    if(!_cfg || steps < 2 || step_mm == 0.0f) return;
+
+    pid_cfg_t cfg = *_cfg;
+    cfg.mode &= (uint8_t)~PID_MODE_2DOF;
+    pid[0] = pid_create();
+    pid[0].init_cfg(&pid[0], &cfg);
+
+    cfg.mode |= PID_MODE_2DOF;
+    cfg.setpoint_weight_b = b;
+    cfg.setpoint_weight_c = c;
+    if(tf_s > 0.0f) cfg.diff_filter_tf = tf_s;
+    pid[1] = pid_create();
+    pid[1].init_cfg(&pid[1], &cfg);
+
+    /* 调节带 ±2%, 不小于死区的两倍 (仿真对象无摩擦, 死区内的残余输出会使位置停在死区边缘) */
+    float band = fabsf(step_mm) * 0.02f;
+    if((cfg.features & PID_FEAT_DEADBAND) && band < 2.0f * cfg.dead_band) band = 2.0f * cfg.dead_band;
+    uint16_t half = steps / 2;
+
+    for(uint16_t i = 0; i < steps; ++i) {
+        float d = (i >= half) ? load : 0.0f;
+        float t = (float)(i + 1) * _dt_s;
+
+        for(k = 0; k < 2; ++k) {
+            float u = pid[k].calculate(&pid[k], step_mm, pos[k], _dt_s);
+            _plant_step(&pos[k], &vel[k], u, d);
+
+            float err = step_mm - pos[k];
+            if(i < half) {
+                if(fabsf(u) >= cfg.max_out) out->sat_s[k] += _dt_s;
+                float over = -err * (step_mm > 0.0f ? 1.0f : -1.0f);
+                if(over > peak[k]) peak[k] = over;
+                if(fabsf(err) > band) t_out[k] = t;
+                if(i == half - 1) {
+                    out->overshoot_pct[k] = peak[k] / fabsf(step_mm) * 100.0f;
+                    out->settle_s[k] = (fabsf(err) <= band) ? t_out[k] : -1.0f;
+                    t_out[k] = t;
+                    pos_d[k] = pos[k];
+                }
+            }
+            else {
+                float dev = fabsf(pos[k] - pos_d[k]);
+                if(dev > out->dist_dev_mm[k]) out->dist_dev_mm[k] = dev;
+                if(fabsf(err) > band) t_out[k] = t;
+                if(i == steps - 1) {
+                    out->dist_settle_s[k] = (fabsf(err) <= band) ? t_out[k] - (float)half * _dt_s : -1.0f;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief   识别对比测试命令并挂起 (不在此运行)
+ * @param   cmd 命令字符串 ("$...#")
+ * @retval  bool true:是对比测试命令, 已挂起
+ */
+bool s_pid_bench_request(const char* cmd) {
+    float b, c, tf;
+
+    if(strcmp(cmd, "$PID_BENCH#") == 0) {
+        _req = PidBenchReqRun;
+    }
+    else if(strcmp(cmd, "$PID_BENCH_KERNEL#") == 0) {
+        _req = PidBenchReqKernel;
+    }
+    else if(strcmp(cmd, "$PID_BENCH_BANK#") == 0) {
+        _req = PidBenchReqBank;
+    }
+    else if(strcmp(cmd, "$PID_BENCH_2DOF#") == 0) {
+        _req = PidBenchReq2dof;
+        _req_args[0] = PID_BENCH_2DOF_B;
+        _req_args[1] = 0.0f;
+        _req_args[2] = 0.0f;
+    }
+    else if(sscanf(cmd, "$PID_BENCH_2DOF:%f,%f,%f#", &b, &c, &tf) == 3) {
+        _req = PidBenchReq2dof;
+        _req_args[0] = b;
+        _req_args[1] = c;
+        _req_args[2] = tf;
+    }
+    else {
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief   运行挂起的命令并回复
+ * @param   None
+ * @retval  None
+ * @note    阻塞到仿真结束 (数百至上千个控制周期的计算), 只在升降台空闲时调用
+ */
+void s_pid_bench_execute(void) {
+    PidBenchReq_e req = _req;
+    _req = PidBenchReqNone;
+
+    switch(req) {
+        case PidBenchReqRun: {
+            pid_bench_result_t res;
+            s_pid_bench_run(PID_BENCH_STEP_MM, PID_BENCH_STEPS, &res);
+            printf("$PID:BENCH,%lu,%lu,%.4f,%.3f,%.3f,%.3f#", (unsigned long)res.cyc_float, (unsigned long)res.cyc_q16,
+                res.max_du, res.max_dpos_mm, res.err_float_mm, res.err_q16_mm);
+            break;
+        }
+        case PidBenchReqKernel:
+            for(uint8_t i = 0; i < PidKernelCount; ++i) {
+                pid_kernel_result_t res;
+                s_pid_bench_kernel((PidKernel_e)i, PID_BENCH_STEP_MM, PID_BENCH_STEPS, &res);
+                printf("$PID:KERNEL,%u,%lu,%lu,%.6f#", (unsigned)i, (unsigned long)res.cyc_dynamic,
+                    (unsigned long)res.cyc_static, res.max_du);
+            }
+            break;
+        case PidBenchReqBank: {
+            pid_bank_result_t res;
+            s_pid_bench_bank(PID_BANK_MAX, PID_BENCH_STEP_MM, PID_BENCH_STEPS, &res);
+            printf("$PID:BANK,%u,%u,%u,%lu,%lu,%.6f#", (unsigned)PID_BANK_MAX, (unsigned)res.ram_struct,
+                (unsigned)res.ram_bank, (unsigned long)res.cyc_struct, (unsigned long)res.cyc_bank, res.max_du);
+            break;
+        }
+        case PidBenchReq2dof:
+            _report_2dof(_req_args[0], _req_args[1], _req_args[2]);
+            break;
+        case PidBenchReqNone:
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief   拒绝挂起的命令 (升降台不在空闲状态)
+ * @param   None
+ * @retval  None
+ */
+void s_pid_bench_reject(void) {
+    if(_req == PidBenchReqNone) return;
+    _req = PidBenchReqNone;
+    printf("$PID:BENCH_BUSY#");
+}
+
+// ! ========================= 私 有 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   仿真对象前进一个周期
+ * @param   pos 位置 (mm), 原地更新
+ * @param   vel 速度 (mm/s), 原地更新
+ * @param   u 占空比 (限幅到 ±1)
+ * @param   load 负载扰动 (等效占空比, 叠加在限幅之后)
+ * @retval  None
+ */
+static void _plant_step(float* pos, float* vel, float u, float load) {
+    if(u > 1.0f) u = 1.0f;
+    if(u < -1.0f) u = -1.0f;
+
+    *vel += ((u + load) * _plant->v_max - *vel) * _dt_s / _plant->tau_s;
+    *pos += *vel * _dt_s;
+}
+
+/**
+ * @brief   运行一自由度 / 二自由度 PID 对比并回复两行结果
+ * @param   b 比例设定值权重
+ * @param   c 微分设定值权重
+ * @param   tf_s 微分滤波时间常数 (0 = 沿用配置表)
+ * @retval  None
+ */
+static void _report_2dof(float b, float c, float tf_s) {
+    pid_2dof_result_t res;
+    s_pid_bench_2dof(b, c, tf_s, PID_BENCH_2DOF_STEP_MM, PID_BENCH_2DOF_STEPS, PID_BENCH_2DOF_LOAD, &res);
+
+    for(uint8_t k = 0; k < 2; ++k) {
+        printf("$PID:2DOF,%u,%.2f,%.2f,%.2f,%.3f,%.2f#", (unsigned)k, res.overshoot_pct[k], res.settle_s[k],
+            res.sat_s[k], res.dist_dev_mm[k], res.dist_settle_s[k]);
+    }
+}
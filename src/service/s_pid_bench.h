@@ -0,0 +1,123 @@
+/**
+ * @file    s_pid_bench.h
+ * @brief   PID 实现对比测试服务 (浮点 / Q16.16 定点, 动态 / 编译期特化)
+ * @note    s_pid_bench_run: 浮点与定点两种实现使用同一配置表, 各自驱动一个仿真升降台 (一阶速度滞后 + 积分),
+ *          从 0 阶跃到 step_mm, 同步运行 steps 个控制周期:
+ *          - 每次 calculate 用 s_bench 计时 (条目 "pid_float" / "pid_q16", $BENCH# 可见)
+ *          - 统计两者输出与位置的最大偏差及最终误差, 检查定点量化对闭环的影响
+ *          仿真本身为浮点运算, 不计入周期数. 运行期间阻塞调用者 (数百周期约十余 ms),
+ *          只应在升降台静止时执行; 服务不访问硬件, 可直接在主机上编译运行
+ *
+ *          s_pid_bench_kernel: 对几种常用模式 / 特性组合, 以同样方式比较动态 calculate
+ *          与 PID_DEFINE 特化核 (条目 "pid_float" / "pid_static"), 两者都经函数指针调用,
+ *          周期差即逐次特性判断的开销; 输出应完全一致
+ *
+ *          s_pid_bench_bank: n 个 PID 对象逐个计算 与 一个 PIDBank 批量计算 的比较
+ *          (条目 "pid_float" / "pid_bank", 周期为整轮耗时), 各通道阶跃幅度不同
+ *
+ *          s_pid_bench_2dof: 配置表原样 (一自由度) 与 加上 PID_MODE_2DOF / 给定权重与微分时间常数
+ *          的两个控制器各驱动一个仿真对象: 先阶跃到 step_mm, 半程时对象上加入负载扰动 (占空比),
+ *          分别统计设定值响应 (超调 / 调节时间 / 饱和时间) 与扰动响应 (最大偏离 / 恢复时间).
+ *          两者增益相同, 扰动前都已调节到位时扰动响应一致, 差别只在设定值响应
+ *
+ *          -------- 命令 --------
+ *          通信服务收到 $PID_BENCH# / $PID_BENCH_KERNEL# / $PID_BENCH_BANK# / $PID_BENCH_2DOF[:b,c,tf]# 时
+ *          调用 s_pid_bench_request 挂起, 由状态机在空闲状态下调用 s_pid_bench_execute 运行并回复
+ *          ($PID:BENCH / KERNEL / BANK / 2DOF); 其他状态调用 s_pid_bench_reject 回复 $PID:BENCH_BUSY#
+ */
+#ifndef _s_pid_bench_h_
+#define _s_pid_bench_h_
+
+#include "s_pid.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// ! ========================= 接 口 变 量 / Typedef 声 明 ========================= ! //
+
+// $PID_BENCH# 使用的阶跃幅度与周期数
+#define PID_BENCH_STEP_MM   50.0f
+#define PID_BENCH_STEPS     300u
+
+// $PID_BENCH_2DOF# 的阶跃幅度 (小阶跃, 输出不长时间处于限幅, 比例冲击的差别才看得出), 周期数 (半程加入扰动),
+// 扰动大小 (占空比, 负为向下的负载) 与默认比例权重
+#define PID_BENCH_2DOF_STEP_MM  5.0f
+#define PID_BENCH_2DOF_STEPS    1000u
+#define PID_BENCH_2DOF_LOAD     (-0.2f)
+#define PID_BENCH_2DOF_B        0.7f
+
+/**
+ * @brief 仿真对象参数
+ */
+typedef struct {
+    float v_max;                    // 满占空比稳态速度 (mm/s)
+    float tau_s;                    // 速度一阶滞后时间常数
+} pid_bench_plant_t;
+
+/**
+ * @brief 特化核对比的配置 (增益沿用初始化时的配置表)
+ */
+typedef enum {
+    PidKernelP = 0,                 // P
+    PidKernelPI,                    // PI + 限幅 + 抗饱和
+    PidKernelPID,                   // PID + 限幅 + 抗饱和 + 微分滤波
+    PidKernelLift,                  // 升降台位置环的组合 (另加积分分离, 死区, 微分先行)
+    PidKernelCount
+} PidKernel_e;
+
+/**
+ * @brief 特化核对比结果
+ */
+typedef struct {
+    uint32_t cyc_dynamic;           // 动态版平均周期数 / 次
+    uint32_t cyc_static;            // 特化核平均周期数 / 次
+    float max_du;                   // 输出最大偏差 (应为 0)
+} pid_kernel_result_t;
+
+/**
+ * @brief 批量计算对比结果
+ */
+typedef struct {
+    uint16_t ram_struct;            // PID 对象每通道字节数
+    uint16_t ram_bank;              // PIDBank 满载时每通道字节数 (含公共部分分摊)
+    uint32_t cyc_struct;            // 逐个计算: 每通道平均周期数
+    uint32_t cyc_bank;              // 批量计算: 每通道平均周期数
+    float max_du;                   // 输出最大偏差 (应为 0)
+} pid_bank_result_t;
+
+/**
+ * @brief 二自由度对比结果 ([0] 一自由度, [1] 二自由度)
+ */
+typedef struct {
+    float overshoot_pct[2];         // 阶跃超调 (%)
+    float settle_s[2];              // 阶跃调节时间 (扰动前仍未进入调节带为 -1; 调节带 ±2%, 不小于死区的两倍)
+    float sat_s[2];                 // 阶跃阶段输出处于限幅的累计时间 (比例冲击)
+    float dist_dev_mm[2];           // 扰动引起的最大偏离 (相对扰动开始时的位置)
+    float dist_settle_s[2];         // 扰动后回到调节带的时间 (结束时仍在带外为 -1)
+} pid_2dof_result_t;
+
+/**
+ * @brief 对比结果
+ */
+typedef struct {
+    uint32_t cyc_float;             // 浮点版平均周期数 / 次
+    uint32_t cyc_q16;               // 定点版平均周期数 / 次
+    float max_du;                   // 输出最大偏差
+    float max_dpos_mm;              // 位置最大偏差
+    float err_float_mm;             // 浮点版最终误差
+    float err_q16_mm;               // 定点版最终误差
+} pid_bench_result_t;
+
+// ! ========================= 接 口 函 数 声 明 ========================= ! //
+
+void s_pid_bench_init(const pid_cfg_t* cfg, const pid_bench_plant_t* plant, float dt_s);
+void s_pid_bench_run(float step_mm, uint16_t steps, pid_bench_result_t* out);
+void s_pid_bench_kernel(PidKernel_e which, float step_mm, uint16_t steps, pid_kernel_result_t* out);
+void s_pid_bench_bank(uint8_t n, float step_mm, uint16_t steps, pid_bank_result_t* out);
+void s_pid_bench_2dof(float b, float c, float tf_s, float step_mm, uint16_t steps, float load, pid_2dof_result_t* out);
+
+bool s_pid_bench_request(const char* cmd);
+void s_pid_bench_execute(void);
+void s_pid_bench_reject(void);
+
+#endif
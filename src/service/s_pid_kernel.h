@@ -0,0 +1,276 @@
+/**
+ * @file    s_pid_kernel.h
+ * @brief   PID 计算核 (编译期特化)
+ *          PID_KERNEL_BODY 为浮点 PID 计算的唯一实现:
+ *          - s_pid.c 的 _calculate 以运行时的 mode_ / features_ 展开, 即动态版本
+ *          - PID_DEFINE 以常量 mode / features 展开, 未启用的阶段在编译期被消除,
+ *            不再逐次测试八个特性位, 也省去函数指针间接调用
+ *          位置式与增量式 (PID_MODE_INCREMENTAL) 各有一个计算体, 二自由度 (PID_MODE_2DOF)
+ *          只改变比例 / 微分项的输入, 两种计算体共用 PID_KERNEL_WEIGHTS / PID_KERNEL_DIFF_ALPHA
+ * @note
+ *          -------- 用法 --------
+ *          PID_DEFINE(pos_pid_calc, PID_MODE_PI, PID_FEAT_OUTPUT_LIMIT | PID_FEAT_ANTI_WINDUP)
+ *
+ *          PID pid = pid_create();
+ *          pid.init_cfg(&pid, &cfg);                     // cfg.mode / cfg.features 应与上面一致
+ *          float out = pos_pid_calc(&pid, target, actual, dt_s);
+ *
+ *          生成的函数与 calculate 签名相同, 也可赋给 pid.calculate 供通用代码调用;
+ *          特化核只读取参数与状态, 忽略实例中的 mode_ / features_
+ */
+#ifndef _s_pid_kernel_h_
+#define _s_pid_kernel_h_
+
+#include "s_pid.h"
+
+// ! ========================= 接 口 变 量 / Typedef 声 明 ========================= ! //
+
+#define PID_ABS(x)              ((x) >= 0.0f ? (x) : -(x))
+#define PID_CLAMP(v, lo, hi)    ((v) > (hi) ? (hi) : ((v) < (lo) ? (lo) : (v)))
+
+/**
+ * @brief   生成编译期特化的 PID 计算函数
+ * @param   name     函数名
+ * @param   mode     PID 模式 (常量, PID_MODE_xxx)
+ * @param   features 功能特性 (常量, PID_FEAT_xxx 按位或)
+ */
+#define PID_DEFINE(name, mode, features)                                            \
+    static float name(PID* pid, float target, float actual, float dt_s) {          \
+        PID_KERNEL_BODY((mode), (features))                                         \
+    }
+
+/**
+ * @brief   比例项输入 ep 与微分项输入 ed (在 err 经过死区之后展开)
+ * @note    非二自由度: ep = err, ed 不使用; 二自由度: ep = b·r - y (死区内与死区外连续), ed = c·r - y
+ */
+#define PID_KERNEL_WEIGHTS(MODE)                                                    \
+    float ep = err;                                                                 \
+    float ed = 0.0f;                                                                \
+    if((MODE) & PID_MODE_2DOF) {                                                    \
+        ep -= (1.0f - pid->sp_weight_b_) * target;                                  \
+        ed = pid->sp_weight_c_ * target - actual;                                   \
+    }                                                                               \
+    (void)ed;
+
+/**
+ * @brief   微分滤波系数: 配置了时间常数时按实际周期计算, 否则取固定系数
+ */
+#define PID_KERNEL_DIFF_ALPHA()                                                     \
+    ((pid->diff_filter_tf_ > 0.0f && dt_s > 0.0f)                                   \
+        ? (dt_s / (pid->diff_filter_tf_ + dt_s)) : pid->diff_filter_alpha_)
+
+/**
+ * @brief   PID 计算函数体 (引用函数参数 pid / target / actual / dt_s)
+ * @param   MODE PID 模式
+ * @param   FEAT 功能特性
+ * @note    dt_s 为 0 时积分离散累加, 微分项不计算
+ */
+#define PID_KERNEL_BODY(MODE, FEAT)                                                 \
+    if((MODE) & PID_MODE_INCREMENTAL) {                                             \
+        PID_KERNEL_INCREMENTAL(MODE, FEAT)                                          \
+    }                                                                               \
+    else {                                                                          \
+        PID_KERNEL_POSITIONAL(MODE, FEAT)                                           \
+    }
+
+/**
+ * @brief   增量式计算: Δu = kp·Δe + ki·e·dt + kd·Δd, 累计于 integral_
+ * @note    微分 d 的计算与位置式相同 (含微分先行 / 滤波), _filtered_diff_ 保存上一周期的 d;
+ *          二自由度时 Δe 取 b·r - y 的变化, prev_err_ 保存 b·r - y;
+ *          累计值不随限幅回写: 回写会丢掉被限幅截去的比例项, 大误差回落时输出随 kp·Δe
+ *          提前离开限幅, 误差不变时停在限幅内 (积分分离下不再变化); 抗饱和改为输出饱和且
+ *          误差同向时不累加积分增量, 累计值即 kp·e + kd·d + 积分 (+ 改增益时的接续量), 有界
+ */
+#define PID_KERNEL_INCREMENTAL(MODE, FEAT)                                          \
+    float err = target - actual;                                                    \
+                                                                                    \
+    if(((FEAT) & PID_FEAT_DEADBAND) && PID_ABS(err) < pid->dead_band_) {            \
+        err = 0.0f;                                                                 \
+    }                                                                               \
+                                                                                    \
+    PID_KERNEL_WEIGHTS(MODE)                                                        \
+    float du = 0.0f;                                                                \
+                                                                                    \
+    if((MODE) & PID_MODE_P) {                                                       \
+        du += pid->kp_ * (ep - pid->prev_err_);                                     \
+    }                                                                               \
+                                                                                    \
+    /* 积分分离: 误差过大时不累加积分增量; 输出饱和且误差同向时同样不累加 (条件积分) */ \
+    if((MODE) & PID_MODE_I) {                                                       \
+        uint8_t allow_integral = 1;                                                 \
+        if(((FEAT) & PID_FEAT_INTEGRAL_SEP) && PID_ABS(err) > pid->integral_separation_) {  \
+            allow_integral = 0;                                                     \
+        }                                                                           \
+        if((FEAT) & PID_FEAT_OUTPUT_LIMIT) {                                        \
+            if(pid->_prev_output_ >= pid->max_out_ && err > 0.0f) allow_integral = 0;   \
+            if(pid->_prev_output_ <= -pid->max_out_ && err < 0.0f) allow_integral = 0;  \
+        }                                                                           \
+        if(allow_integral) {                                                        \
+            du += pid->ki_ * ((dt_s > 0.0f) ? (err * dt_s) : err);                  \
+        }                                                                           \
+    }                                                                               \
+                                                                                    \
+    if((MODE) & PID_MODE_D) {                                                       \
+        float diff;                                                                 \
+                                                                                    \
+        if((MODE) & PID_MODE_2DOF) {                                                \
+            diff = (dt_s > 0.0f) ? ((ed - pid->_prev_measurement_) / dt_s) : 0.0f;  \
+            pid->_prev_measurement_ = ed;                                           \
+        }                                                                           \
+        else if((FEAT) & PID_FEAT_DIFF_ON_MEAS) {                                   \
+            diff = (dt_s > 0.0f) ? (-(actual - pid->_prev_measurement_) / dt_s) : 0.0f; \
+            pid->_prev_measurement_ = actual;                                       \
+        }                                                                           \
+        else {                                                                      \
+            diff = (dt_s > 0.0f) ? ((err - pid->prev_err_) / dt_s) : 0.0f;          \
+        }                                                                           \
+                                                                                    \
+        if((FEAT) & PID_FEAT_DIFF_FILTER) {                                         \
+            float alpha = PID_KERNEL_DIFF_ALPHA();                                  \
+            diff = alpha * diff + (1.0f - alpha) * pid->_filtered_diff_;            \
+        }                                                                           \
+                                                                                    \
+        du += pid->kd_ * (diff - pid->_filtered_diff_);                             \
+        pid->_filtered_diff_ = diff;                                                \
+    }                                                                               \
+                                                                                    \
+    pid->prev_err_ = ep;                                                            \
+                                                                                    \
+    float ff = ((FEAT) & PID_FEAT_FEEDFORWARD) ? pid->ff_value_ : 0.0f;             \
+    pid->integral_ += du;                                                           \
+    float out = pid->integral_ + ff;                                                \
+                                                                                    \
+    if((FEAT) & PID_FEAT_OUTPUT_LIMIT) {                                            \
+        out = PID_CLAMP(out, -pid->max_out_, pid->max_out_);                        \
+    }                                                                               \
+                                                                                    \
+    if((FEAT) & PID_FEAT_OUTPUT_RATE_LIMIT) {                                       \
+        if(dt_s > 0.0f) {                                                           \
+            float max_change = pid->output_max_rate_ * dt_s;                        \
+            float delta = out - pid->_prev_output_;                                 \
+            if(PID_ABS(delta) > max_change) {                                       \
+                out = pid->_prev_output_ + (delta > 0.0f ? max_change : -max_change);   \
+            }                                                                       \
+        }                                                                           \
+    }                                                                               \
+                                                                                    \
+    pid->output_ = out;                                                             \
+    pid->_prev_output_ = out;                                                       \
+                                                                                    \
+    return out;
+
+/**
+ * @brief   位置式计算
+ */
+#define PID_KERNEL_POSITIONAL(MODE, FEAT)                                           \
+    float err = target - actual;                                                    \
+                                                                                    \
+    /* 死区 */                                                                      \
+    if(((FEAT) & PID_FEAT_DEADBAND) && PID_ABS(err) < pid->dead_band_) {            \
+        err = 0.0f;                                                                 \
+    }                                                                               \
+                                                                                    \
+    PID_KERNEL_WEIGHTS(MODE)                                                        \
+    float out = 0.0f;                                                               \
+                                                                                    \
+    /* 比例项 (二自由度时作用于 b·r - y) */                                         \
+    if((MODE) & PID_MODE_P) {                                                       \
+        out += pid->kp_ * ep;                                                       \
+    }                                                                               \
+                                                                                    \
+    /* 积分项 */                                                                    \
+    if((MODE) & PID_MODE_I) {                                                       \
+        uint8_t allow_integral = 1;                                                 \
+        uint8_t allow_separation = 0;                                               \
+                                                                                    \
+        /* 积分抗饱和 : 条件积分法 (输出饱和且误差同向时禁止积分) */                \
+        if((FEAT) & PID_FEAT_ANTI_WINDUP) {                                         \
+            if(pid->_prev_output_ >= pid->max_out_ && err > 0.0f) allow_integral = 0;   \
+            if(pid->_prev_output_ <= -pid->max_out_ && err < 0.0f) allow_integral = 0;  \
+        }                                                                           \
+                                                                                    \
+        if(allow_integral) {                                                        \
+            pid->integral_ += (dt_s > 0.0f) ? (err * dt_s) : err;                   \
+        }                                                                           \
+                                                                                    \
+        /* 积分分离 (误差过大时不叠加积分输出) */                                   \
+        if((FEAT) & PID_FEAT_INTEGRAL_SEP) {                                        \
+            if(PID_ABS(err) > pid->integral_separation_) {                          \
+                allow_separation = 1;                                               \
+            }                                                                       \
+        }                                                                           \
+                                                                                    \
+        if(!allow_separation) {                                                     \
+            out += pid->ki_ * pid->integral_;                                       \
+        }                                                                           \
+    }                                                                               \
+                                                                                    \
+    /* 微分项 */                                                                    \
+    if((MODE) & PID_MODE_D) {                                                       \
+        float diff;                                                                 \
+                                                                                    \
+        /* 二自由度: 基于 c·r - y 的变化率 (c = 0 即微分先行) */                    \
+        if((MODE) & PID_MODE_2DOF) {                                                \
+            diff = (dt_s > 0.0f) ? ((ed - pid->_prev_measurement_) / dt_s) : 0.0f;  \
+            pid->_prev_measurement_ = ed;                                           \
+        }                                                                           \
+        /* 微分先行: 基于测量值变化率, 避免目标突变时 D 项跳变 */                   \
+        else if((FEAT) & PID_FEAT_DIFF_ON_MEAS) {                                   \
+            diff = (dt_s > 0.0f) ? (-(actual - pid->_prev_measurement_) / dt_s) : 0.0f; \
+            pid->_prev_measurement_ = actual;                                       \
+        }                                                                           \
+        else {                                                                      \
+            diff = (dt_s > 0.0f) ? ((err - pid->prev_err_) / dt_s) : 0.0f;          \
+            pid->prev_err_ = err;                                                   \
+        }                                                                           \
+                                                                                    \
+        /* 微分滤波: 一阶低通 */                                                    \
+        if((FEAT) & PID_FEAT_DIFF_FILTER) {                                         \
+            float alpha = PID_KERNEL_DIFF_ALPHA();                                  \
+            diff = alpha * diff + (1.0f - alpha) * pid->_filtered_diff_;            \
+            pid->_filtered_diff_ = diff;                                            \
+        }                                                                           \
+                                                                                    \
+        out += pid->kd_ * diff;                                                     \
+    }                                                                               \
+                                                                                    \
+    /* 前馈 */                                                                      \
+    if((FEAT) & PID_FEAT_FEEDFORWARD) {                                             \
+        out += pid->ff_value_;                                                      \
+    }                                                                               \
+                                                                                    \
+    /* 保存未限幅输出, 用于反计算法抗饱和 */                                        \
+    float total_output = out;                                                       \
+    (void)total_output;                                                             \
+                                                                                    \
+    /* 输出限幅 */                                                                  \
+    if((FEAT) & PID_FEAT_OUTPUT_LIMIT) {                                            \
+        out = PID_CLAMP(out, -pid->max_out_, pid->max_out_);                        \
+    }                                                                               \
+                                                                                    \
+    /* 输出变化率限制 */                                                            \
+    if((FEAT) & PID_FEAT_OUTPUT_RATE_LIMIT) {                                       \
+        if(dt_s > 0.0f) {                                                           \
+            float max_change = pid->output_max_rate_ * dt_s;                        \
+            float delta = out - pid->_prev_output_;                                 \
+            if(PID_ABS(delta) > max_change) {                                       \
+                out = pid->_prev_output_ + (delta > 0.0f ? max_change : -max_change);   \
+            }                                                                       \
+        }                                                                           \
+    }                                                                               \
+                                                                                    \
+    /* 积分抗饱和 : 反计算法 (back-calculation) */                                  \
+    if(((MODE) & PID_MODE_I) && ((FEAT) & PID_FEAT_ANTI_WINDUP) && ((FEAT) & PID_FEAT_OUTPUT_LIMIT)) {  \
+        float output_diff = total_output - out;                                     \
+        if(PID_ABS(pid->kp_) > 1e-6f && PID_ABS(pid->ki_) > 1e-6f) {                \
+            float Kb = pid->ki_ / pid->kp_;  /* Kb = 1/Tt = Ki/Kp */                \
+            pid->integral_ -= output_diff * Kb * dt_s;                              \
+        }                                                                           \
+    }                                                                               \
+                                                                                    \
+    pid->output_ = out;                                                             \
+    pid->_prev_output_ = out;                                                       \
+                                                                                    \
+    return out;
+
+#endif
@@ -0,0 +1,319 @@
+/**
+ * @file    s_pid_q16.c
+ * @brief   定点 (Q16.16) PID 控制器实现
+ */
+#include "s_pid_q16.h"
+
+// ! ========================= 变 量 声 明 ========================= ! //
+
+// 增益小于该值视为 0 (与浮点版反计算法的判断一致)
+#define PID_Q16_GAIN_EPS    1e-6f
+
+// ! ========================= 私 有 函 数 声 明 ========================= ! //
+
+static q16_t _sat(int64_t v);
+static q16_t _add(q16_t a, q16_t b);
+static q16_t _sub(q16_t a, q16_t b);
+static q16_t _mul(q16_t a, q16_t b);
+static q16_t _abs(q16_t a);
+
+static void _init(PIDQ16* pid, uint8_t mode, uint8_t features, float dt_s);
+static void _init_cfg(PIDQ16* pid, const pid_cfg_t* cfg, float dt_s);
+static void _set_gains(PIDQ16* pid, float kp, float ki, float kd);
+static void _set_params(PIDQ16* pid, float max_out, float integral_separation,
+    float dead_band, float diff_filter_alpha, float output_max_rate);
+static void _set_feedforward(PIDQ16* pid, q16_t ff_value);
+static q16_t _calculate(PIDQ16* pid, q16_t target, q16_t actual);
+static void _reset(PIDQ16* pid);
+static void _track(PIDQ16* pid, float output, float target, float actual);
+
+// ! ========================= 接 口 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   创建定点 PID 实例
+ * @return  PID 实例
+ */
+PIDQ16 pid_q16_create(void) {
+    PIDQ16 pid;
+
+    pid.init = _init;
+    pid.init_cfg = _init_cfg;
+    pid.set_gains = _set_gains;
+    pid.set_params = _set_params;
+    pid.set_feedforward = _set_feedforward;
+    pid.calculate = _calculate;
+    pid.reset = _reset;
+    pid.track = _track;
+
+    return pid;
+}
+
+/**
+ * @brief   浮点 -> Q16.16 (四舍五入, 超出范围时饱和)
+ * @param   x 浮点值
+ * @return  定点值
+ */
+q16_t q16_from_float(float x) {
+    float v = x * 65536.0f;
+    if(v >= 2147483647.0f) return Q16_MAX;
+    if(v <= -2147483648.0f) return Q16_MIN;
+    return (q16_t)(v >= 0.0f ? v + 0.5f : v - 0.5f);
+}
+
+/**
+ * @brief   Q16.16 -> 浮点
+ * @param   x 定点值
+ * @return  浮点值
+ */
+float q16_to_float(q16_t x) {
+    return (float)x * (1.0f / 65536.0f);
+}
+
+// ! ========================= 私 有 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   64 位中间结果饱和到 int32
+ */
+static q16_t _sat(int64_t v) {
+    if(v > Q16_MAX) return Q16_MAX;
+    if(v < Q16_MIN) return Q16_MIN;
+    return (q16_t)v;
+}
+
+/**
+ * @brief   饱和加法
+ */
+static q16_t _add(q16_t a, q16_t b) {
+    return _sat((int64_t)a + b);
+}
+
+/**
+ * @brief   饱和减法
+ */
+static q16_t _sub(q16_t a, q16_t b) {
+    return _sat((int64_t)a - b);
+}
+
+/**
+ * @brief   饱和乘法 (SMULL, 结果四舍五入回 Q16.16)
+ */
+static q16_t _mul(q16_t a, q16_t b) {
+    return _sat(((int64_t)a * b + 0x8000) >> 16);
+}
+
+/**
+ * @brief   饱和绝对值 (Q16_MIN 取 Q16_MAX)
+ */
+static q16_t _abs(q16_t a) {
+    if(a >= 0) return a;
+    return (a == Q16_MIN) ? Q16_MAX : -a;
+}
+
+/**
+ * @brief   初始化 PID 控制器
+ * @param   pid      PID 实例指针
+ * @param   mode     PID 模式 (PID_MODE_xxx)
+ * @param   features 功能特性 (PID_FEAT_xxx 按位或)
+ * @param   dt_s     控制周期 (秒)
+ */
+static void _init(PIDQ16* pid, uint8_t mode, uint8_t features, float dt_s) {
+    pid->mode_ = mode;
+    pid->features_ = features;
+    pid->_periodic_ = (dt_s > 0.0f);
+    pid->_dt_s_ = pid->_periodic_ ? dt_s : 0.0f;
+
+    _set_gains(pid, 0.0f, 0.0f, 0.0f);
+    _set_params(pid, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f);
+    pid->ff_value_ = 0;
+
+    _reset(pid);
+}
+
+/**
+ * @brief   通过配置表初始化 PID 控制器
+ * @param   pid  PID 实例指针
+ * @param   cfg  配置结构体指针
+ * @param   dt_s 控制周期 (秒)
+ */
+static void _init_cfg(PIDQ16* pid, const pid_cfg_t* cfg, float dt_s) {
+    _init(pid, cfg->mode, cfg->features, dt_s);
+    _set_gains(pid, cfg->kp, cfg->ki, cfg->kd);
+    float alpha = cfg->diff_filter_alpha;
+    if(cfg->diff_filter_tf > 0.0f && dt_s > 0.0f) {
+        alpha = dt_s / (cfg->diff_filter_tf + dt_s);
+    }
+    _set_params(pid, cfg->max_out, cfg->integral_separation, cfg->dead_band,
+        alpha, cfg->output_max_rate);
+}
+
+/**
+ * @brief   设置 PID 增益 (预计算 ki·dt, kd/dt 与反计算系数)
+ */
+static void _set_gains(PIDQ16* pid, float kp, float ki, float kd) {
+    float dt = pid->_dt_s_;
+
+    pid->kp_ = q16_from_float(kp);
+    pid->ki_dt_ = q16_from_float(dt > 0.0f ? ki * dt : ki);
+    pid->kd_dt_ = (dt > 0.0f) ? q16_from_float(kd / dt) : 0;
+
+    /* 浮点版: integral -= diff·(ki/kp)·dt, 输出变化为 ki 倍; 此处积分已含 ki */
+    pid->_kb_dt_ = 0;
+    if((kp > PID_Q16_GAIN_EPS || kp < -PID_Q16_GAIN_EPS) && (ki > PID_Q16_GAIN_EPS || ki < -PID_Q16_GAIN_EPS)) {
+        pid->_kb_dt_ = q16_from_float(ki * ki / kp * dt);
+    }
+}
+
+/**
+ * @brief   设置高级参数
+ */
+static void _set_params(PIDQ16* pid, float max_out, float integral_separation,
+    float dead_band, float diff_filter_alpha, float output_max_rate) {
+    pid->max_out_ = q16_from_float(max_out);
+    pid->integral_separation_ = q16_from_float(integral_separation);
+    pid->dead_band_ = q16_from_float(dead_band);
+    pid->diff_filter_alpha_ = q16_from_float(diff_filter_alpha);
+    pid->output_max_step_ = q16_from_float(output_max_rate * pid->_dt_s_);
+}
+
+/**
+ * @brief   设置前馈值
+ */
+static void _set_feedforward(PIDQ16* pid, q16_t ff_value) {
+    pid->ff_value_ = ff_value;
+}
+
+/**
+ * @brief   计算 PID 输出
+ * @param   pid    PID 实例指针
+ * @param   target 目标值
+ * @param   actual 实际值
+ * @return  PID 输出值
+ * @note    各阶段与浮点版 _calculate 一一对应; 微分滤波作用于每周期差分,
+ *          乘 kd/dt 之后与浮点版对变化率滤波等价
+ */
+static q16_t _calculate(PIDQ16* pid, q16_t target, q16_t actual) {
+    q16_t err = _sub(target, actual);
+    uint8_t feat = pid->features_;
+    uint8_t mode = pid->mode_;
+
+    /* 死区 */
+    if((feat & PID_FEAT_DEADBAND) && _abs(err) < pid->dead_band_) {
+        err = 0;
+    }
+
+    q16_t out = 0;
+
+    /* 比例项 */
+    if(mode & PID_MODE_P) {
+        out = _mul(pid->kp_, err);
+    }
+
+    /* 积分项 */
+    if(mode & PID_MODE_I) {
+        uint8_t allow_integral = 1;
+
+        /* 积分抗饱和 : 条件积分法 */
+        if(feat & PID_FEAT_ANTI_WINDUP) {
+            if(pid->_prev_output_ >= pid->max_out_ && err > 0) allow_integral = 0;
+            if(pid->_prev_output_ <= -pid->max_out_ && err < 0) allow_integral = 0;
+        }
+
+        if(allow_integral) {
+            pid->integral_ = _add(pid->integral_, _mul(pid->ki_dt_, err));
+        }
+
+        /* 积分分离 */
+        if(!((feat & PID_FEAT_INTEGRAL_SEP) && _abs(err) > pid->integral_separation_)) {
+            out = _add(out, pid->integral_);
+        }
+    }
+
+    /* 微分项 */
+    if(mode & PID_MODE_D) {
+        q16_t diff;
+
+        if(feat & PID_FEAT_DIFF_ON_MEAS) {
+            diff = _sub(pid->_prev_measurement_, actual);
+            pid->_prev_measurement_ = actual;
+        }
+        else {
+            diff = _sub(err, pid->prev_err_);
+            pid->prev_err_ = err;
+        }
+
+        /* 一阶低通: f += alpha·(d - f) */
+        if(feat & PID_FEAT_DIFF_FILTER) {
+            diff = _add(pid->_filtered_diff_, _mul(pid->diff_filter_alpha_, _sub(diff, pid->_filtered_diff_)));
+            pid->_filtered_diff_ = diff;
+        }
+
+        out = _add(out, _mul(pid->kd_dt_, diff));
+    }
+
+    /* 前馈 */
+    if(feat & PID_FEAT_FEEDFORWARD) {
+        out = _add(out, pid->ff_value_);
+    }
+
+    q16_t total_output = out;
+
+    /* 输出限幅 */
+    if(feat & PID_FEAT_OUTPUT_LIMIT) {
+        if(out > pid->max_out_) out = pid->max_out_;
+        else if(out < -pid->max_out_) out = -pid->max_out_;
+    }
+
+    /* 输出变化率限制 */
+    if((feat & PID_FEAT_OUTPUT_RATE_LIMIT) && pid->_periodic_) {
+        q16_t delta = _sub(out, pid->_prev_output_);
+        if(delta > pid->output_max_step_) out = _add(pid->_prev_output_, pid->output_max_step_);
+        else if(delta < -pid->output_max_step_) out = _sub(pid->_prev_output_, pid->output_max_step_);
+    }
+
+    /* 积分抗饱和 : 反计算法 */
+    if((mode & PID_MODE_I) && (feat & PID_FEAT_ANTI_WINDUP) && (feat & PID_FEAT_OUTPUT_LIMIT)) {
+        pid->integral_ = _sub(pid->integral_, _mul(_sub(total_output, out), pid->_kb_dt_));
+    }
+
+    pid->output_ = out;
+    pid->_prev_output_ = out;
+
+    return out;
+}
+
+/**
+ * @brief   重置 PID 控制器状态 (不改变参数)
+ */
+static void _reset(PIDQ16* pid) {
+    pid->output_ = 0;
+    pid->integral_ = 0;
+    pid->prev_err_ = 0;
+    pid->_filtered_diff_ = 0;
+    pid->_prev_output_ = 0;
+    pid->_prev_measurement_ = 0;
+}
+
+/**
+ * @brief   输出跟踪 (无扰切换)
+ * @note    积分已含 ki, 直接取 output - P - 前馈, 不需要除以 ki
+ */
+static void _track(PIDQ16* pid, float output, float target, float actual) {
+    q16_t out = q16_from_float(output);
+    q16_t err = _sub(q16_from_float(target), q16_from_float(actual));
+
+    if((pid->features_ & PID_FEAT_DEADBAND) && _abs(err) < pid->dead_band_) {
+        err = 0;
+    }
+
+    if(pid->mode_ & PID_MODE_I) {
+        q16_t base = (pid->features_ & PID_FEAT_FEEDFORWARD) ? pid->ff_value_ : 0;
+        if(pid->mode_ & PID_MODE_P) base = _add(base, _mul(pid->kp_, err));
+        pid->integral_ = _sub(out, base);
+    }
+
+    pid->prev_err_ = err;
+    pid->_prev_measurement_ = q16_from_float(actual);
+    pid->_filtered_diff_ = 0;
+    pid->_prev_output_ = out;
+    pid->output_ = out;
+}
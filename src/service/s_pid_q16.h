@@ -0,0 +1,137 @@
+/**
+ * @file    s_pid_q16.h
+ * @brief   定点 (Q16.16) PID 控制器
+ *          功能特性与浮点版一致 (PID_MODE_xxx / PID_FEAT_xxx / pid_cfg_t 通用),
+ *          用于无 FPU 的 Cortex-M3: 每次计算只有整数乘加, 不调用软浮点库
+ * @note
+ *          -------- 与浮点版的差异 --------
+ *          1. 控制周期 dt 在初始化时给定, ki·dt, kd/dt, 输出变化率·dt 预先算好,
+ *             calculate 不再传入 dt, 也不做除法; 实际周期偏离 dt 时按 dt 计算
+ *          2. integral_ 保存的是积分项输出 (Σ ki·dt·err), 修改 ki 时积分输出不跳变
+ *          3. 所有加减乘均饱和到 int32 范围, 不会溢出翻转
+ *          4. 不支持 PID_MODE_INCREMENTAL / PID_MODE_2DOF, 这两位被忽略 (按位置式计算);
+ *             配置了 diff_filter_tf 时按初始化的 dt 换算为固定滤波系数
+ *          5. 分辨率 2^-16 ≈ 1.5e-5: ki·dt 等很小的系数有量化误差, 增益应使其远大于该值
+ *
+ *          -------- 用法 --------
+ *          PIDQ16 pid = pid_q16_create();
+ *          pid.init_cfg(&pid, &cfg, 0.01f);            // 与浮点版共用配置表
+ *          q16_t out = pid.calculate(&pid, q16_from_float(target), q16_from_float(actual));
+ */
+#ifndef _s_pid_q16_h_
+#define _s_pid_q16_h_
+
+#include "s_pid.h"
+
+#include <stdint.h>
+
+// ! ========================= 接 口 变 量 / Typedef 声 明 ========================= ! //
+
+typedef int32_t q16_t;
+
+#define Q16_ONE         ((q16_t)0x00010000)
+#define Q16_MAX         ((q16_t)0x7FFFFFFF)
+#define Q16_MIN         ((q16_t)(-0x7FFFFFFF - 1))
+
+/**
+ * @brief 定点 PID 控制器类
+ */
+typedef struct PIDQ16 PIDQ16;
+struct PIDQ16 {
+// public:
+    uint8_t mode_;                  // PID 模式
+    uint8_t features_;              // 功能特性
+
+    q16_t kp_;
+    q16_t ki_dt_;                   // ki·dt (dt 为 0 时为 ki)
+    q16_t kd_dt_;                   // kd/dt (dt 为 0 时为 0)
+
+    q16_t max_out_;                 // 最大输出值
+    q16_t integral_separation_;     // 积分分离阈值
+    q16_t dead_band_;               // 死区阈值
+    q16_t diff_filter_alpha_;       // 微分滤波系数
+    q16_t output_max_step_;         // 每周期输出最大变化量 (变化率·dt)
+    q16_t ff_value_;                // 前馈值
+
+    q16_t output_;                  // 当前输出
+    q16_t integral_;                // 积分项输出
+    q16_t prev_err_;                // 上一次误差
+
+    /**
+     * @brief   初始化 PID 控制器
+     * @param   pid      PID 实例指针
+     * @param   mode     PID 模式 (PID_MODE_xxx)
+     * @param   features 功能特性 (PID_FEAT_xxx 按位或)
+     * @param   dt_s     控制周期 (秒); 0 时积分离散累加, 微分项不计算
+     */
+    void(*init)(PIDQ16* pid, uint8_t mode, uint8_t features, float dt_s);
+    /**
+     * @brief   通过配置表初始化 PID 控制器
+     * @param   pid  PID 实例指针
+     * @param   cfg  配置结构体指针 (与浮点版通用)
+     * @param   dt_s 控制周期 (秒)
+     */
+    void(*init_cfg)(PIDQ16* pid, const pid_cfg_t* cfg, float dt_s);
+    /**
+     * @brief   设置 PID 增益 (换算为定点系数)
+     * @param   pid PID 实例指针
+     * @param   kp  比例系数
+     * @param   ki  积分系数
+     * @param   kd  微分系数
+     */
+    void(*set_gains)(PIDQ16* pid, float kp, float ki, float kd);
+    /**
+     * @brief   设置高级参数
+     * @param   pid                 PID 实例指针
+     * @param   max_out             最大输出值
+     * @param   integral_separation 积分分离阈值
+     * @param   dead_band           死区阈值
+     * @param   diff_filter_alpha   微分滤波系数 (0~1)
+     * @param   output_max_rate     输出最大变化率 (每秒)
+     */
+    void(*set_params)(PIDQ16* pid, float max_out, float integral_separation,
+        float dead_band, float diff_filter_alpha, float output_max_rate);
+    /**
+     * @brief   设置前馈值
+     * @param   pid      PID 实例指针
+     * @param   ff_value 前馈值 (Q16.16)
+     */
+    void(*set_feedforward)(PIDQ16* pid, q16_t ff_value);
+    /**
+     * @brief   计算 PID 输出 (按初始化时的周期)
+     * @param   pid    PID 实例指针
+     * @param   target 目标值 (Q16.16)
+     * @param   actual 实际值 (Q16.16)
+     * @return  PID 输出值 (Q16.16)
+     */
+    q16_t(*calculate)(PIDQ16* pid, q16_t target, q16_t actual);
+    /**
+     * @brief   重置 PID 控制器状态 (不改变参数)
+     * @param   pid PID 实例指针
+     */
+    void(*reset)(PIDQ16* pid);
+    /**
+     * @brief   输出跟踪 (无扰切换), 同浮点版 track; 非周期调用, 参数为浮点
+     * @param   pid    PID 实例指针
+     * @param   output 当前实际施加的输出
+     * @param   target 当前目标值
+     * @param   actual 当前实际值
+     */
+    void(*track)(PIDQ16* pid, float output, float target, float actual);
+
+// private:
+    float _dt_s_;
+    uint8_t _periodic_;             // dt > 0 (calculate 中不做浮点比较)
+    q16_t _kb_dt_;                  // 反计算抗饱和系数 ki²·dt/kp
+    q16_t _filtered_diff_;          // 滤波后的每周期差分
+    q16_t _prev_output_;
+    q16_t _prev_measurement_;
+};
+
+// ! ========================= 接 口 函 数 声 明 ========================= ! //
+
+PIDQ16 pid_q16_create(void);
+q16_t q16_from_float(float x);
+float q16_to_float(q16_t x);
+
+#endif
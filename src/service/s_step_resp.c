@@ -0,0 +1,215 @@
+/**
+ * @file    s_step_resp.c
+ * @brief   阶跃响应分析服务实现
+ */
+#include "s_step_resp.h"
+
+#include <math.h>
+
+// ! ========================= 变 量 声 明 ========================= ! //
+
+#define STEP_RESP_POS_SCALE     10.0f       // 0.1 mm
+#define STEP_RESP_U_SCALE       10000.0f    // 0.0001
+
+static const step_resp_cfg_t* _cfg = 0;
+
+static step_resp_sample_t _buf[STEP_RESP_BUF_LEN];
+static uint16_t _n;                 // 已记录样本数
+static uint16_t _decim;             // 抽取倍数
+static uint16_t _decim_cnt;         // 距上次记录的周期数
+
+static float _target;
+static float _y0;                   // 起点
+static float _step;                 // 阶跃幅度
+static float _band;                 // 调节带半宽
+static float _t;                    // 已用时间
+static float _t10;                  // 到达 10% 的时刻 (<0 未到达)
+static float _t90;
+static float _over_mm;              // 越过目标的最大距离
+static float _t_out;                // 最后一次在调节带外的时刻
+static bool _in_band;               // 最近一个样本在调节带内
+static float _iae;
+
+static step_resp_result_t _result;
+static bool _result_valid = false;
+
+// ! ========================= 私 有 函 数 声 明 ========================= ! //
+
+static int16_t _quant(float v, float scale);
+static void _store(float target_mm, float pos_mm, float u);
+
+// ! ========================= 接 口 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   初始化阶跃响应分析
+ * @param   cfg 分析参数
+ * @retval  None
+ */
+void s_step_resp_init(const step_resp_cfg_t* cfg) {
+    _cfg = cfg;
+    _n = 0;
+    _decim = 1;
+}
+
+/**
+ * @brief   开始记录一次阶跃 (清空缓冲区)
+ * @param   target_mm 目标位置
+ * @param   pos_mm 起点位置
+ * @retval  None
+ */
+void s_step_resp_start(float target_mm, float pos_mm) {
+    _n = 0;
+    _decim = 1;
+    _decim_cnt = 0;
+
+    _target = target_mm;
+    _y0 = pos_mm;
+    _step = target_mm - pos_mm;
+    _band = _cfg ? fabsf(_step) * _cfg->band_pct / 100.0f : 0.0f;
+    if(_cfg && _band < _cfg->band_min_mm) _band = _cfg->band_min_mm;
+
+    _t = 0.0f;
+    _t10 = -1.0f;
+    _t90 = -1.0f;
+    _over_mm = 0.0f;
+    _t_out = 0.0f;
+    _in_band = false;
+    _iae = 0.0f;
+}
+
+/**
+ * @brief   记录一个控制周期 (每个控制周期调用一次)
+ * @param   target_mm 目标位置 (改变时重新开始)
+ * @param   pos_mm 当前位置
+ * @param   u 控制输出
+ * @param   dt_s 距上次调用的时间
+ * @retval  None
+ */
+void s_step_resp_sample(float target_mm, float pos_mm, float u, float dt_s) {
+    if(!_cfg) return;
+    if(target_mm != _target) s_step_resp_start(target_mm, pos_mm);
+
+    _t += dt_s;
+    float err = target_mm - pos_mm;
+    _iae += fabsf(err) * dt_s;
+
+    /* 行程比例 (按阶跃方向归一化) */
+    if(_step != 0.0f) {
+        float progress = (pos_mm - _y0) / _step;
+        if(_t10 < 0.0f && progress >= 0.1f) _t10 = _t;
+        if(_t90 < 0.0f && progress >= 0.9f) _t90 = _t;
+        float over = (progress - 1.0f) * fabsf(_step);
+        if(over > _over_mm) _over_mm = over;
+    }
+
+    _in_band = fabsf(err) <= _band;
+    if(!_in_band) _t_out = _t;
+
+    if(++_decim_cnt >= _decim) {
+        _decim_cnt = 0;
+        _store(target_mm, pos_mm, u);
+    }
+}
+
+/**
+ * @brief   结束记录并计算指标
+ * @param   out 结果输出 (可为 0, 之后用 s_step_resp_result 读取)
+ * @retval  None
+ */
+void s_step_resp_finish(step_resp_result_t* out) {
+    _result.step_mm = _step;
+    _result.rise_s = (_t10 >= 0.0f && _t90 >= 0.0f) ? (_t90 - _t10) : -1.0f;
+    _result.overshoot_pct = (_step != 0.0f) ? _over_mm / fabsf(_step) * 100.0f : 0.0f;
+    _result.settle_s = _in_band ? _t_out : -1.0f;
+    _result.iae = _iae;
+    _result.samples = _n;
+    _result.decim = _decim;
+
+    /* 稳态误差: 最后若干样本的平均 */
+    uint16_t k = (_cfg && _cfg->ss_samples < _n) ? _cfg->ss_samples : _n;
+    float sum = 0.0f;
+    for(uint16_t i = _n - k; i < _n; ++i) {
+        sum += (float)(_buf[i].target - _buf[i].pos);
+    }
+    _result.sse_mm = k ? sum / (float)k / STEP_RESP_POS_SCALE : 0.0f;
+
+    _result_valid = true;
+    if(out) *out = _result;
+}
+
+/**
+ * @brief   获取最近一次结果
+ * @param   out 结果输出
+ * @retval  bool true:有结果
+ */
+bool s_step_resp_result(step_resp_result_t* out) {
+    if(_result_valid) *out = _result;
+    return _result_valid;
+}
+
+/**
+ * @brief   获取已记录样本数
+ * @param   None
+ * @retval  uint16_t 样本数
+ */
+uint16_t s_step_resp_count(void) {
+    return _n;
+}
+
+/**
+ * @brief   获取当前抽取倍数
+ * @param   None
+ * @retval  uint16_t 样本间隔的控制周期数
+ */
+uint16_t s_step_resp_decim(void) {
+    return _decim;
+}
+
+/**
+ * @brief   读取样本
+ * @param   idx 序号
+ * @param   out 样本输出
+ * @retval  bool true:成功
+ */
+bool s_step_resp_get(uint16_t idx, step_resp_sample_t* out) {
+    if(idx >= _n) return false;
+    *out = _buf[idx];
+    return true;
+}
+
+// ! ========================= 私 有 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   量化为 int16 (饱和)
+ * @param   v 数值
+ * @param   scale 比例
+ * @retval  int16_t 量化值
+ */
+static int16_t _quant(float v, float scale) {
+    float q = v * scale;
+    if(q > 32767.0f) return 32767;
+    if(q < -32768.0f) return -32768;
+    return (int16_t)(q >= 0.0f ? q + 0.5f : q - 0.5f);
+}
+
+/**
+ * @brief   存入一个样本; 缓冲区满时隔点丢弃一半, 抽取倍数加倍
+ * @param   target_mm 目标
+ * @param   pos_mm 位置
+ * @param   u 输出
+ * @retval  None
+ */
+static void _store(float target_mm, float pos_mm, float u) {
+    if(_n >= STEP_RESP_BUF_LEN) {
+        for(uint16_t i = 0; i < STEP_RESP_BUF_LEN / 2; ++i) {
+            _buf[i] = _buf[2 * i];
+        }
+        _n = STEP_RESP_BUF_LEN / 2;
+        _decim *= 2;
+    }
+
+    _buf[_n].target = _quant(target_mm, STEP_RESP_POS_SCALE);
+    _buf[_n].pos = _quant(pos_mm, STEP_RESP_POS_SCALE);
+    _buf[_n].u = _quant(u, STEP_RESP_U_SCALE);
+    _n++;
+}
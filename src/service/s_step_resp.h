@@ -0,0 +1,79 @@
+/**
+ * @file    s_step_resp.h
+ * @brief   阶跃响应分析服务
+ * @note    定位过程中每个控制周期记录 目标 / 位置 / 输出, 结束时给出调参用的性能指标:
+ *
+ *          位置 ^            超调
+ *          目标 |- - - - -.-'^'-.- - -.-.-.----  ← 调节带 ±band
+ *               |        /       `-'
+ *           90% |- - - -/
+ *               |      /
+ *           10% |- - -/
+ *          起点 +----'--------------------------> t
+ *                    |<->| 上升时间    |<- 调节时间: 最后一次离开调节带
+ *
+ *          - 上升时间: 行程 10% -> 90%
+ *          - 超调: 越过目标的最大距离 / 阶跃幅度
+ *          - 稳态误差: 记录中最后 ss_samples 个样本的平均误差
+ *          - IAE: ∑|目标 - 位置|·dt (mm·s)
+ *          指标在采样时逐点累计, 不依赖缓冲区长度; 缓冲区只用于导出曲线:
+ *          写满后隔点丢弃一半并把抽取倍数加倍, 任意长的定位都能保留完整 (降采样) 的曲线.
+ *          样本按 0.1 mm / 0.0001 占空比存为 int16, 每点 6 字节
+ */
+#ifndef _s_step_resp_h_
+#define _s_step_resp_h_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// ! ========================= 接 口 变 量 / Typedef 声 明 ========================= ! //
+
+// 缓冲区样本数 (偶数)
+#ifndef STEP_RESP_BUF_LEN
+#define STEP_RESP_BUF_LEN   256u
+#endif
+
+/**
+ * @brief 分析参数
+ */
+typedef struct {
+    float band_pct;                 // 调节带: 阶跃幅度的百分比
+    float band_min_mm;              // 调节带下限 (小阶跃时)
+    uint16_t ss_samples;            // 稳态误差取记录中最后若干样本
+} step_resp_cfg_t;
+
+/**
+ * @brief 记录的样本
+ */
+typedef struct {
+    int16_t target;                 // 目标 (0.1 mm)
+    int16_t pos;                    // 位置 (0.1 mm)
+    int16_t u;                      // 输出 (0.0001)
+} step_resp_sample_t;
+
+/**
+ * @brief 分析结果
+ */
+typedef struct {
+    float step_mm;                  // 阶跃幅度 (目标 - 起点)
+    float rise_s;                   // 上升时间 (未到 90% 时为 -1)
+    float overshoot_pct;            // 超调 (%)
+    float settle_s;                 // 调节时间 (结束时仍在调节带外为 -1)
+    float sse_mm;                   // 稳态误差
+    float iae;                      // 误差绝对值积分 (mm·s)
+    uint16_t samples;               // 记录样本数
+    uint16_t decim;                 // 抽取倍数 (样本间隔 = decim 个控制周期)
+} step_resp_result_t;
+
+// ! ========================= 接 口 函 数 声 明 ========================= ! //
+
+void s_step_resp_init(const step_resp_cfg_t* cfg);
+void s_step_resp_start(float target_mm, float pos_mm);
+void s_step_resp_sample(float target_mm, float pos_mm, float u, float dt_s);
+void s_step_resp_finish(step_resp_result_t* out);
+bool s_step_resp_result(step_resp_result_t* out);
+uint16_t s_step_resp_count(void);
+uint16_t s_step_resp_decim(void);
+bool s_step_resp_get(uint16_t idx, step_resp_sample_t* out);
+
+#endif
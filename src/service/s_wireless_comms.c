@@ -4,18 +4,29 @@
  *          升降台升降 + 夹爪开合
  */
 #include "s_wireless_comms.h"
+#include "s_bench.h"
+#include "s_lift_gains.h"
+#include "s_lift_latency.h"
+#include "s_lift_limit.h"
+#include "s_lift_ff.h"
+#include "s_lift_smith.h"
+#include "s_lift_queue.h"
+#include "s_pid_bench.h"
+#include "s_step_resp.h"
 
 #include <stdio.h>
 
 // ! ========================= 变 量 声 明 ========================= ! //
 
 float lift_target_pos_mm = 0.0f;
+lift_req_t lift_req = { LiftReqNone, { 0.0f, 0.0f } };
 
 static usart_t* _usart;
-static Relay* _lift_relay;
+static void (*_lift_drive)(float u);   // 升降台驱动: u ∈ [-1, 1], 0 停止
 static Gripper* _gripper;
 
 static uint8_t _rx_buf[USART_RX_BUF_SIZE];
+static bool _motion_locked = false;   // 错误状态下禁止直接驱动升降台
 static bool _cmd_start = false;
 static bool _cmd_ready = false;
 static uint8_t _cmd_idx = 1;
@@ -24,12 +35,18 @@ static uint8_t _cmd_idx = 1;
 
 static void _parse_cmd(uint8_t* cmd);
 static bool _compare_cmd(uint8_t* cmd, const char* target);
+static void _queue_push(float pos_mm, uint32_t dwell_ms);
+static float _clamp_target(float target_mm);
+static void _gains_report(void);
+static void _step_dump(void);
+static void _smith_report(void);
+static void _ff_report(void);
 
 // ! ========================= 接 口 函 数 实 现 ========================= ! //
 
-void s_wireless_comms_init(usart_t* usart, Relay* lift_relay, Gripper* gripper) {
+void s_wireless_comms_init(usart_t* usart, void (*lift_drive)(float u), Gripper* gripper) {
     _usart = usart;
-    _lift_relay = lift_relay;
+    _lift_drive = lift_drive;
     _gripper = gripper;
 }
 
@@ -77,6 +94,15 @@ bool s_wireless_comms_process(void) {
     return false;
 }
 
+/**
+ * @brief   锁定/解锁升降台运动命令
+ * @param   lock true: $LIFT_UP / $LIFT_DOWN / $LIFT_SET / $LIFT_QUEUE 被拒绝
+ * @retval  None
+ */
+void s_wireless_comms_lock_motion(bool lock) {
+    _motion_locked = lock;
+}
+
 // ! ========================= 私 有 函 数 实 现 ========================= ! //
 
 /**
@@ -84,32 +110,208 @@ bool s_wireless_comms_process(void) {
  * @param   cmd 待解析的命令字符串
  */
 static void _parse_cmd(uint8_t* cmd) {
-    float fvalue;
+    float fvalue, fvalue2;
+    float pts[LIFT_GAINS_POINTS];
+    int ivalue, ivalue2, ivalue3;
+    lift_gains_t g;
+
+    // 锁定时拒绝运动命令
+    if(_motion_locked && (_compare_cmd(cmd, "$LIFT_UP#") || _compare_cmd(cmd, "$LIFT_DOWN#")
+        || sscanf((char*)cmd, "$LIFT_SET:%f#", &fvalue) == 1 || sscanf((char*)cmd, "$LIFT_QUEUE:%f", &fvalue) == 1
+        || _compare_cmd(cmd, "$LIFT_AUTOTUNE#") || sscanf((char*)cmd, "$LIFT_AUTOTUNE:%d#", &ivalue) == 1
+        || _compare_cmd(cmd, "$LIFT_IDENT#") || _compare_cmd(cmd, "$LIFT_FF_IDENT#"))) {
+        printf("$LIFT:LOCKED#");
+    }
 
     // 升降台升降命令
-    if(_compare_cmd(cmd, "$LIFT_UP#")) {
-        _lift_relay->set_dir(_lift_relay, RelayDirA);
+    else if(_compare_cmd(cmd, "$LIFT_UP#")) {
+        lift_req.req = LiftReqJog;
+        lift_req.args[0] = 1.0f;
     }
     else if(_compare_cmd(cmd, "$LIFT_DOWN#")) {
-        _lift_relay->set_dir(_lift_relay, RelayDirB);
+        lift_req.req = LiftReqJog;
+        lift_req.args[0] = -1.0f;
     }
     else if(_compare_cmd(cmd, "$LIFT_STOP#")) {
-        _lift_relay->stop(_lift_relay);
+        _lift_drive(0.0f);
+        lift_req.req = LiftReqStop;
     }
     else if(sscanf((char*)cmd, "$LIFT_SET:%f#", &fvalue) == 1) {
-        lift_target_pos_mm = fvalue;
+        s_lift_queue_clear();           // 直接设定目标取代航点队列
+        lift_target_pos_mm = _clamp_target(fvalue);
+    }
+
+    // 软限位命令
+    else if(sscanf((char*)cmd, "$LIFT_LIMITS:%f,%f#", &fvalue, &fvalue2) == 2) {
+        lift_req.req = LiftReqLimits;
+        lift_req.args[0] = fvalue;
+        lift_req.args[1] = fvalue2;
+    }
+    else if(_compare_cmd(cmd, "$LIFT_LIMITS#")) {
+        float lo, hi;
+        s_lift_limit_get(&lo, &hi);
+        printf("$LIFT:LIMITS,%.2f,%.2f#", lo, hi);
+    }
+
+    // 航点队列命令
+    else if(sscanf((char*)cmd, "$LIFT_QUEUE:%f,%d#", &fvalue, &ivalue) == 2) {
+        _queue_push(_clamp_target(fvalue), ivalue > 0 ? (uint32_t)ivalue : 0);
+    }
+    else if(sscanf((char*)cmd, "$LIFT_QUEUE:%f#", &fvalue) == 1) {
+        _queue_push(_clamp_target(fvalue), 0);
+    }
+    else if(_compare_cmd(cmd, "$LIFT_QUEUE_CLEAR#")) {
+        s_lift_queue_clear();
+    }
+    else if(_compare_cmd(cmd, "$LIFT_QUEUE_STATUS#")) {
+        lift_wp_t wp;
+        if(s_lift_queue_peek(0, &wp))
+            printf("$LIFT:QUEUE,%u,%lu,%.2f#", (unsigned)s_lift_queue_count(),
+                (unsigned long)s_lift_queue_reached(), wp.pos_mm);
+        else
+            printf("$LIFT:QUEUE,0,%lu#", (unsigned long)s_lift_queue_reached());
+    }
+
+    // 回零命令
+    else if(_compare_cmd(cmd, "$LIFT_HOME#")) {
+        lift_req.req = LiftReqHome;
+        lift_req.args[0] = 0.0f;
+    }
+    else if(_compare_cmd(cmd, "$LIFT_REHOME#")) {
+        lift_req.req = LiftReqHome;
+        lift_req.args[0] = 1.0f;
+    }
+
+    // 自整定命令
+    else if(_compare_cmd(cmd, "$LIFT_AUTOTUNE#")) {
+        lift_req.req = LiftReqAutotune;
+        lift_req.args[0] = 1.0f;        // 默认 Tyreus-Luyben
+    }
+    else if(sscanf((char*)cmd, "$LIFT_AUTOTUNE:%d#", &ivalue) == 1) {
+        lift_req.req = LiftReqAutotune;
+        lift_req.args[0] = (float)ivalue;
+    }
+
+    // 纯滞后补偿命令 (辨识结果写入 Flash 并启用, 启用 / 停用只作用于 RAM)
+    else if(_compare_cmd(cmd, "$LIFT_IDENT#")) {
+        lift_req.req = LiftReqIdent;
+    }
+    else if(_compare_cmd(cmd, "$SMITH#")) {
+        _smith_report();
+    }
+    else if(sscanf((char*)cmd, "$SMITH:%d#", &ivalue) == 1) {
+        s_lift_smith_enable(ivalue != 0);
+        _smith_report();
+    }
+
+    // 前馈模型命令 (辨识结果写入 Flash 并启用, 启用 / 停用只作用于 RAM)
+    else if(_compare_cmd(cmd, "$LIFT_FF_IDENT#")) {
+        lift_req.req = LiftReqFfIdent;
+    }
+    else if(_compare_cmd(cmd, "$FF#")) {
+        _ff_report();
+    }
+    else if(sscanf((char*)cmd, "$FF:%d#", &ivalue) == 1) {
+        s_lift_ff_enable(ivalue != 0);
+        _ff_report();
+    }
+
+    // 增益调度命令 (修改只作用于 RAM, $PID_SCHED_SAVE# 写入 Flash)
+    else if(_compare_cmd(cmd, "$PID_SCHED#")) {
+        _gains_report();
+    }
+    else if(sscanf((char*)cmd, "$PID_SCHED:%d,%d,%d,%f,%f,%f#", &ivalue, &ivalue2, &ivalue3, &g.kp, &g.ki, &g.kd) == 6) {
+        float lo, hi;
+        s_lift_limit_get(&lo, &hi);
+        s_lift_gains_enable(lo, hi);
+        if(ivalue2 >= 0 && ivalue3 >= 0
+            && s_lift_gains_set(ivalue >= 0 ? 1 : -1, (LiftLoad_e)ivalue2, (uint8_t)ivalue3, &g))
+            printf("$PID:SCHED_SET,%d,%d,%d,%.4f,%.4f,%.4f#", ivalue >= 0 ? 1 : -1, ivalue2, ivalue3, g.kp, g.ki, g.kd);
+        else
+            printf("$PID:SCHED_INVALID#");
+    }
+    else if(sscanf((char*)cmd, "$PID_SCHED_POS:%f,%f,%f#", &pts[0], &pts[1], &pts[2]) == LIFT_GAINS_POINTS) {
+        float lo, hi;
+        s_lift_limit_get(&lo, &hi);
+        s_lift_gains_enable(lo, hi);
+        if(s_lift_gains_set_points(pts))
+            printf("$PID:SCHED_POS,%.2f,%.2f,%.2f#", pts[0], pts[1], pts[2]);
+        else
+            printf("$PID:SCHED_INVALID#");
+    }
+    else if(_compare_cmd(cmd, "$PID_SCHED_OFF#")) {
+        s_lift_gains_disable();
+    }
+    else if(_compare_cmd(cmd, "$PID_SCHED_SAVE#")) {
+        lift_req.req = LiftReqGainsSave;
+    }
+    else if(sscanf((char*)cmd, "$LIFT_LOAD:%d#", &ivalue) == 1) {
+        s_lift_gains_set_load(ivalue ? LiftLoadHeld : LiftLoadEmpty);
+    }
+
+    // 故障清除命令
+    else if(_compare_cmd(cmd, "$FAULT_CLEAR#")) {
+        lift_req.req = LiftReqFaultClear;
+    }
+
+    // 编码器标定命令
+    else if(_compare_cmd(cmd, "$LIFT_CAL_MARK#")) {
+        lift_req.req = LiftReqCalibMark;
+    }
+    else if(sscanf((char*)cmd, "$LIFT_CAL:%f,%d#", &fvalue, &ivalue) == 2) {
+        lift_req.req = LiftReqCalib;
+        lift_req.args[0] = fvalue;
+        lift_req.args[1] = (float)ivalue;
     }
 
     // 夹爪开合命令
     else if(_compare_cmd(cmd, "$GRIP_OPEN#")) {
         _gripper->open(_gripper);
+        s_lift_gains_set_load(LiftLoadEmpty);
     }
     else if(_compare_cmd(cmd, "$GRIP_CLOSE#")) {
         _gripper->close(_gripper);
+        s_lift_gains_set_load(LiftLoadHeld);
     }
     else if(sscanf((char*)cmd, "$GRIP_SET:%f#", &fvalue) == 1) {
         _gripper->set_angle(_gripper, fvalue);
     }
+
+    // 调试命令
+    else if(_compare_cmd(cmd, "$BENCH#")) {
+        s_bench_report();
+    }
+    else if(_compare_cmd(cmd, "$BENCH_RESET#")) {
+        s_bench_reset();
+    }
+    else if(s_pid_bench_request((const char*)cmd)) {
+        // 对比测试阻塞数十毫秒, 由状态机只在空闲时运行
+        lift_req.req = LiftReqPidBench;
+    }
+    else if(_compare_cmd(cmd, "$STEP#")) {
+        step_resp_result_t sr;
+        if(s_step_resp_result(&sr))
+            printf("$STEP:%.2f,%.3f,%.2f,%.3f,%.3f,%.3f#", sr.step_mm, sr.rise_s, sr.overshoot_pct, sr.settle_s, sr.sse_mm, sr.iae);
+        else
+            printf("$STEP:NONE#");
+    }
+    else if(_compare_cmd(cmd, "$STEP_DUMP#")) {
+        _step_dump();
+    }
+    else if(_compare_cmd(cmd, "$LIFT_RELAY#")) {
+        lift_req.req = LiftReqReport;
+    }
+    else if(_compare_cmd(cmd, "$LIFT_LATENCY#")) {
+        for(uint8_t i = 0; i < LiftLatencyCount; ++i) {
+            lift_latency_stat_t st;
+            s_lift_latency_get((LiftLatency_e)i, &st);
+            printf("$LIFT:LAT,%u,%lu,%.2f,%.2f,%.2f,%.2f#", (unsigned)i, (unsigned long)st.count,
+                st.mean_ms, st.min_ms, st.max_ms, st.last_ms);
+        }
+    }
+    else if(_compare_cmd(cmd, "$LIFT_LATENCY_RESET#")) {
+        s_lift_latency_reset();
+    }
 }
 
 /**
@@ -125,3 +327,92 @@ static bool _compare_cmd(uint8_t* cmd, const char* target) {
 
     return (*cmd == '\0');
 }
+
+/**
+ * @brief   追加航点并回复队列长度
+ * @param   pos_mm 目标位置
+ * @param   dwell_ms 到达后停留时间
+ */
+static void _queue_push(float pos_mm, uint32_t dwell_ms) {
+    if(s_lift_queue_push(pos_mm, dwell_ms))
+        printf("$LIFT:QUEUED,%u#", (unsigned)s_lift_queue_count());
+    else
+        printf("$LIFT:QUEUE_FULL#");
+}
+
+/**
+ * @brief   目标位置钳位到软限位内, 被钳位时回复实际目标
+ * @param   target_mm 请求的目标位置
+ * @retval  float 钳位后的目标
+ */
+static float _clamp_target(float target_mm) {
+    float clamped = s_lift_limit_clamp(target_mm);
+    if(clamped != target_mm) printf("$LIFT:CLAMPED,%.2f#", clamped);
+    return clamped;
+}
+
+/**
+ * @brief   回复增益调度表
+ * @note    先回复 启用, 负载, 断点, 再逐项回复 方向, 负载, 断点序号, kp, ki, kd
+ */
+static void _gains_report(void) {
+    const lift_gain_table_t* t = s_lift_gains_table();
+    if(!t) return;
+
+    printf("$PID:SCHED,%d,%d,%.2f,%.2f,%.2f#", (int)s_lift_gains_enabled(), (int)s_lift_gains_load(),
+        t->pos_mm[0], t->pos_mm[1], t->pos_mm[2]);
+    if(!s_lift_gains_enabled()) return;
+
+    for(uint8_t d = 0; d < 2; ++d) {
+        for(uint8_t l = 0; l < LiftLoadCount; ++l) {
+            for(uint8_t i = 0; i < LIFT_GAINS_POINTS; ++i) {
+                const lift_gains_t* g = &t->gains[d][l][i];
+                printf("$PID:SCHED_G,%d,%u,%u,%.4f,%.4f,%.4f#", d ? -1 : 1, (unsigned)l, (unsigned)i, g->kp, g->ki, g->kd);
+            }
+        }
+    }
+}
+
+/**
+ * @brief   导出阶跃响应记录
+ * @note    先回复 样本数, 抽取倍数 (样本间隔的控制周期数), 再逐点回复整数
+ *          目标 (0.1 mm), 位置 (0.1 mm), 输出 (0.0001), 不做浮点格式化
+ */
+static void _step_dump(void) {
+    uint16_t n = s_step_resp_count();
+    printf("$STEP:H,%u,%u#", (unsigned)n, (unsigned)s_step_resp_decim());
+
+    for(uint16_t i = 0; i < n; ++i) {
+        step_resp_sample_t smp;
+        s_step_resp_get(i, &smp);
+        printf("$STEP:D,%u,%d,%d,%d#", (unsigned)i, smp.target, smp.pos, smp.u);
+    }
+}
+
+/**
+ * @brief   报告纯滞后补偿状态与模型
+ * @note    $SMITH:<启用>,<K mm/s>,<τ s>,<L s>,<扰动估计>#, 无模型时 $SMITH:NONE#
+ */
+static void _smith_report(void) {
+    const lift_fopdt_t* m = s_lift_smith_model();
+    if(!m) {
+        printf("$SMITH:NONE#");
+        return;
+    }
+    printf("$SMITH:%d,%.2f,%.3f,%.3f,%.3f#", (int)s_lift_smith_enabled(), m->k_mm_s, m->tau_s, m->dead_s,
+        s_lift_smith_disturbance());
+}
+
+/**
+ * @brief   报告前馈模型状态与参数
+ * @note    $FF:<启用>,<重力>,<库仑>,<静摩擦上>,<静摩擦下>,<粘性上>,<粘性下>,<惯性>#, 无模型时 $FF:NONE#
+ */
+static void _ff_report(void) {
+    const lift_ff_model_t* m = s_lift_ff_model();
+    if(!m) {
+        printf("$FF:NONE#");
+        return;
+    }
+    printf("$FF:%d,%.3f,%.3f,%.3f,%.3f,%.4f,%.4f,%.5f#", (int)s_lift_ff_enabled(), m->gravity, m->coulomb,
+        m->breakaway[0], m->breakaway[1], m->viscous[0], m->viscous[1], m->inertia);
+}
@@ -7,7 +7,6 @@
 #define _s_wireless_comms_h_
 
 #include "usart.h"
-#include "d_relay.h"
 #include "d_gripper.h"
 #include "d_encoder.h"
 
@@ -15,11 +14,38 @@
 
 // ! ========================= 接 口 变 量 / Typedef 声 明 ========================= ! //
 
+/**
+ * @brief 升降台请求 (由状态机轮询并清除)
+ */
+typedef enum {
+    LiftReqNone = 0,
+    LiftReqStop,                    // 停止 / 中止当前流程
+    LiftReqCalib,                   // 开始编码器标定, args: 间距(mm), 往返次数
+    LiftReqCalibMark,               // 标定参考位置标记
+    LiftReqHome,                    // 回零, args: 1 = 利用已知位置快速回零
+    LiftReqFaultClear,              // 清除故障, 离开错误状态
+    LiftReqReport,                  // 报告驱动器寿命统计
+    LiftReqJog,                     // 点动 (需在超时前重复发送), args: 1 上行, -1 下行
+    LiftReqLimits,                  // 设置并保存软限位, args: 下限位, 上限位
+    LiftReqAutotune,                // 继电反馈自整定, args: 整定规则 (LiftTuneRule_e)
+    LiftReqGainsSave,               // 保存增益调度表
+    LiftReqIdent,                   // 阶跃辨识纯滞后补偿模型
+    LiftReqFfIdent,                 // 匀速试验辨识前馈模型
+    LiftReqPidBench                 // PID 对比测试 (命令由 s_pid_bench 挂起, 只在空闲状态运行)
+} LiftReq_e;
+
+typedef struct {
+    LiftReq_e req;
+    float args[2];
+} lift_req_t;
+
 extern float lift_target_pos_mm;
+extern lift_req_t lift_req;
 
 // ! ========================= 接 口 函 数 声 明 ========================= ! //
 
-void s_wireless_comms_init(usart_t* usart, Relay* lift_relay, Gripper* gripper);
+void s_wireless_comms_init(usart_t* usart, void (*lift_drive)(float u), Gripper* gripper);
 bool s_wireless_comms_process(void);
+void s_wireless_comms_lock_motion(bool lock);
 
 #endif
@@ -0,0 +1,54 @@
+/**
+ * @file    stm32f10x.c
+ * @brief   主机测试用的器件库函数桩
+ */
+#include "stm32f10x.h"
+
+// ! ========================= 变 量 声 明 ========================= ! //
+
+void (*tim_stub_hook)(TIM_TypeDef* tim) = 0;
+
+static uint32_t _primask = 0;
+
+// ! ========================= 接 口 函 数 实 现 ========================= ! //
+
+void RCC_APB1PeriphClockCmd(uint32_t RCC_APB1Periph, FunctionalState NewState) {
+    (void)RCC_APB1Periph;
+    (void)NewState;
+}
+
+void RCC_APB2PeriphClockCmd(uint32_t RCC_APB2Periph, FunctionalState NewState) {
+    (void)RCC_APB2Periph;
+    (void)NewState;
+}
+
+void GPIO_Init(GPIO_TypeDef* GPIOx, GPIO_InitTypeDef* GPIO_InitStruct) {
+    (void)GPIOx;
+    (void)GPIO_InitStruct;
+}
+
+uint16_t TIM_GetCounter(TIM_TypeDef* TIMx) {
+    if(tim_stub_hook) tim_stub_hook(TIMx);
+    return TIMx->CNT;
+}
+
+FlagStatus TIM_GetFlagStatus(TIM_TypeDef* TIMx, uint16_t TIM_FLAG) {
+    if(tim_stub_hook) tim_stub_hook(TIMx);
+    return (TIMx->SR & TIM_FLAG) ? SET : RESET;
+}
+
+void TIM_ClearITPendingBit(TIM_TypeDef* TIMx, uint16_t TIM_IT) {
+    TIMx->SR &= (uint16_t)~TIM_IT;
+}
+
+uint32_t __get_PRIMASK(void) {
+    return _primask;
+}
+
+void __set_PRIMASK(uint32_t primask) {
+    _primask = primask;
+}
+
+void __disable_irq(void) {
+    _primask = 1;
+}
@@ -0,0 +1,72 @@
+/**
+ * @file    stm32f10x.h
+ * @brief   主机测试用的器件头文件桩: 只提供被测模块用到的寄存器、类型与库函数
+ * @note    定时器只模拟 CNT 与 SR (UIF); 测试直接读写寄存器模拟计数与溢出,
+ *          并可设置访问钩子, 在驱动读取寄存器的间隙插入计数变化;
+ *          GPIO 只记录驱动写入的 BSRR / BRR, 时钟与引脚配置为空操作
+ */
+#ifndef _stm32f10x_h_
+#define _stm32f10x_h_
+
+#include <stdint.h>
+
+// ! ========================= 接 口 变 量 / Typedef 声 明 ========================= ! //
+
+typedef enum { RESET = 0, SET = !RESET } FlagStatus;
+typedef enum { DISABLE = 0, ENABLE = !DISABLE } FunctionalState;
+
+typedef enum {
+    GPIO_Speed_10MHz = 1,
+    GPIO_Speed_2MHz,
+    GPIO_Speed_50MHz
+} GPIOSpeed_TypeDef;
+
+typedef enum {
+    GPIO_Mode_AIN = 0x0,
+    GPIO_Mode_IN_FLOATING = 0x04,
+    GPIO_Mode_IPD = 0x28,
+    GPIO_Mode_IPU = 0x48,
+    GPIO_Mode_Out_OD = 0x14,
+    GPIO_Mode_Out_PP = 0x10,
+    GPIO_Mode_AF_OD = 0x1C,
+    GPIO_Mode_AF_PP = 0x18
+} GPIOMode_TypeDef;
+
+typedef struct {
+    volatile uint32_t ODR;
+    volatile uint32_t BSRR;
+    volatile uint32_t BRR;
+} GPIO_TypeDef;
+
+typedef struct {
+    uint16_t GPIO_Pin;
+    GPIOSpeed_TypeDef GPIO_Speed;
+    GPIOMode_TypeDef GPIO_Mode;
+} GPIO_InitTypeDef;
+
+typedef struct {
+    volatile uint16_t SR;
+    volatile uint16_t CNT;
+} TIM_TypeDef;
+
+#define TIM_FLAG_Update         ((uint16_t)0x0001)
+#define TIM_IT_Update           ((uint16_t)0x0001)
+
+// 驱动每次读取 CNT / SR 前调用 (为 0 时不调用)
+extern void (*tim_stub_hook)(TIM_TypeDef* tim);
+
+// ! ========================= 接 口 函 数 声 明 ========================= ! //
+
+void RCC_APB1PeriphClockCmd(uint32_t RCC_APB1Periph, FunctionalState NewState);
+void RCC_APB2PeriphClockCmd(uint32_t RCC_APB2Periph, FunctionalState NewState);
+void GPIO_Init(GPIO_TypeDef* GPIOx, GPIO_InitTypeDef* GPIO_InitStruct);
+
+uint16_t TIM_GetCounter(TIM_TypeDef* TIMx);
+FlagStatus TIM_GetFlagStatus(TIM_TypeDef* TIMx, uint16_t TIM_FLAG);
+void TIM_ClearITPendingBit(TIM_TypeDef* TIMx, uint16_t TIM_IT);
+
+uint32_t __get_PRIMASK(void);
+void __set_PRIMASK(uint32_t primask);
+void __disable_irq(void);
+
+#endif
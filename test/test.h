@@ -0,0 +1,34 @@
+/**
+ * @file    test.h
+ * @brief   主机单元测试的断言与结果汇总
+ * @note    每个测试为独立的主机程序, 失败时打印位置并以非 0 退出
+ */
+#ifndef _test_h_
+#define _test_h_
+
+#include <stdio.h>
+#include <math.h>
+
+// ! ========================= 接 口 变 量 / Typedef 声 明 ========================= ! //
+
+static int _test_failures = 0;
+
+// 条件不成立时记录失败, 其后为 printf 格式的说明
+#define TEST_CHECK(cond, ...) do {                                      \
+        if(!(cond)) {                                                   \
+            printf("FAIL %s:%d: ", __FILE__, __LINE__);                 \
+            printf(__VA_ARGS__);                                        \
+            printf("\n");                                               \
+            ++_test_failures;                                           \
+        }                                                               \
+    } while(0)
+
+// |a - b| <= tol
+#define TEST_NEAR(a, b, tol, what) \
+    TEST_CHECK(fabs((double)(a) - (double)(b)) <= (tol), "%s = %g, expected %g ± %g", what, (double)(a), (double)(b), (double)(tol))
+
+// main 的返回值
+#define TEST_RESULT(name) \
+    (printf("%s: %s\n", name, _test_failures ? "FAILED" : "ok"), _test_failures ? 1 : 0)
+
+#endif
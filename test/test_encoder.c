@@ -0,0 +1,327 @@
+/**
+ * @file    test_encoder.c
+ * @brief   编码器驱动: 16 位计数器溢出扩展为 64 位累计脉冲, α-β-γ 速度观测器
+ * @note    TIM2 的 CNT / SR(UIF) 由桩模拟: 逐个脉冲计数, 越过 65535 <-> 0 时置 UIF;
+ *          溢出中断由测试在读数之后才执行, 覆盖 "已溢出、中断挂起" 时的读数补偿,
+ *          以及读 CNT 与查 UIF 之间恰好溢出的情况; 另测 1 / 2 ms 更新周期下的速度换算,
+ *          以及上下行标定系数不同时位置只取决于计数 (静止抖动不漂移, 同一计数同一位置)
+ */
+#include "test.h"
+#include "d_encoder.h"
+
+// ! ========================= 变 量 声 明 ========================= ! //
+
+static TIM_TypeDef _tim2;
+static const tim_cfg_t _tim2_cfg = {
+    .id = TIM_2,
+    .periph = &_tim2,
+    .mode = TIM_MODE_ENCODER,
+    .prescaler = 0,
+    .period = 0xFFFF,
+    .enable_irq = 1,
+};
+
+static tim_t* _handle = 0;
+static int64_t _true_count = 0;     // 实际累计脉冲
+static int _access = 0;             // 寄存器访问计数
+static int _race_at = 0;            // 第几次访问前插入脉冲 (0 = 不插入)
+static int32_t _race_pulses = 0;
+
+// ! ========================= 私 有 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   定时器 HAL 桩: 只记录配置与回调
+ */
+void tim_init(tim_t* handle, const tim_cfg_t* cfg) {
+    handle->cfg = cfg;
+    handle->flag = 0;
+    handle->callback = 0;
+    handle->arg = 0;
+    _handle = handle;
+}
+
+void tim_set_callback(tim_t* handle, tim_cb_t cb, void* arg) {
+    handle->callback = cb;
+    handle->arg = arg;
+}
+
+/**
+ * @brief   计数器逐个脉冲计数, 溢出 / 下溢时置 UIF
+ */
+static void count(int32_t pulses) {
+    int32_t step = (pulses >= 0) ? 1 : -1;
+    for(int32_t i = 0; i != pulses; i += step) {
+        _tim2.CNT = (uint16_t)(_tim2.CNT + step);
+        if((step > 0 && _tim2.CNT == 0) || (step < 0 && _tim2.CNT == 0xFFFF)) _tim2.SR |= TIM_FLAG_Update;
+        _true_count += step;
+    }
+}
+
+/**
+ * @brief   执行挂起的更新中断 (同 timer.c: 先清标志再回调)
+ */
+static void run_isr(void) {
+    if(_tim2.SR & TIM_FLAG_Update) {
+        TIM_ClearITPendingBit(&_tim2, TIM_IT_Update);
+        _handle->callback(_handle->arg);
+    }
+}
+
+/**
+ * @brief   访问钩子: 第 _race_at 次访问寄存器前插入脉冲
+ */
+static void race_hook(TIM_TypeDef* tim) {
+    (void)tim;
+    if(++_access == _race_at) count(_race_pulses);
+}
+
+/**
+ * @brief   以 start 为初值重新初始化编码器与计数器
+ */
+static void encoder_start(Encoder* enc, uint16_t start) {
+    *enc = encoder_create();
+    enc->init(enc, &_tim2_cfg, 10, 15.518f);
+    _tim2.CNT = start;
+    _tim2.SR = 0;
+    _true_count = start;            // 累计脉冲 = 圈数 × 65536 + CNT, 初始圈数为 0
+    enc->update(enc);
+    enc->set_origin(enc, start);
+}
+
+/**
+ * @brief   先挂起中断读数, 执行中断后再读数, 两次都应等于实际累计脉冲
+ */
+static void check_read(Encoder* enc, const char* what) {
+    int64_t pending = enc->get_pulses(enc);
+    TEST_CHECK(pending == _true_count, "%s (UIF pending): %lld, expected %lld", what, (long long)pending, (long long)_true_count);
+    run_isr();
+    int64_t after = enc->get_pulses(enc);
+    TEST_CHECK(after == _true_count, "%s (after ISR): %lld, expected %lld", what, (long long)after, (long long)_true_count);
+}
+
+/**
+ * @brief   连续上行 / 下行越过多圈
+ */
+static void test_wraps(void) {
+    Encoder enc;
+    encoder_start(&enc, 60000);
+    for(int i = 0; i < 50; ++i) {
+        count(7000 + 311 * i);
+        check_read(&enc, "count up");
+    }
+    for(int i = 0; i < 80; ++i) {
+        count(-(9000 + 97 * i));
+        check_read(&enc, "count down");
+    }
+}
+
+/**
+ * @brief   在 0 / 65535 附近来回, 每次越界后都先读数再执行中断
+ */
+static void test_dither(void) {
+    Encoder enc;
+    encoder_start(&enc, 2);
+    static const int32_t steps[] = {-3, 2, -1, 4, -5, 1, 1, -2, 3, -3};
+    for(int k = 0; k < 20; ++k) {
+        count(steps[k % 10]);
+        check_read(&enc, "dither");
+    }
+}
+
+/**
+ * @brief   读 CNT 之后、查 UIF 之前溢出: 应重读计数并补偿一圈
+ */
+static void test_race(void) {
+    static const int32_t dir[] = {1, -1};
+    for(int d = 0; d < 2; ++d) {
+        for(int at = 1; at <= 3; ++at) {
+            Encoder enc;
+            encoder_start(&enc, dir[d] > 0 ? 65534 : 1);
+            _access = 0;
+            _race_at = at;
+            _race_pulses = 3 * dir[d];
+            tim_stub_hook = race_hook;
+            int64_t c = enc.get_pulses(&enc);
+            tim_stub_hook = 0;
+            // 读数在插入脉冲之前或之后完成都正确, 但不能差一圈
+            int64_t before = _true_count - _race_pulses;
+            TEST_CHECK(c == _true_count || c == before, "race dir %d at %d: %lld, expected %lld or %lld",
+                dir[d], at, (long long)c, (long long)_true_count, (long long)before);
+            run_isr();
+            TEST_CHECK(enc.get_pulses(&enc) == _true_count, "race dir %d at %d after ISR", dir[d], at);
+        }
+    }
+}
+
+/**
+ * @brief   update 在挂起中断时读数, 位置仍连续
+ */
+static void test_update_continuity(void) {
+    Encoder enc;
+    encoder_start(&enc, 65000);
+    for(int i = 0; i < 200; ++i) {
+        count((i < 120) ? 1500 : -2100);
+        enc.update(&enc);
+        run_isr();
+        // 位置 = (累计 - 起点) × um/脉冲, Q16 标定系数舍入误差远小于 1 脉冲
+        double expect_um = (double)(_true_count - 65000) * 1000.0 / 15.518;
+        TEST_CHECK(fabs(enc.get_position_um(&enc) - expect_um) <= 10.0, "update %d: position %d um, expected %.0f um",
+            i, (int)enc.get_position_um(&enc), expect_um);
+    }
+}
+
+/**
+ * @brief   更新周期 1 / 2 ms: 速度换算 (增量 × 更新频率) 不溢出
+ */
+static void test_short_period(void) {
+    static const int periods[] = {1, 2};
+    static const int32_t deltas[] = {3, 1000, -1000, 20000};
+    for(int p = 0; p < 2; ++p) {
+        for(int d = 0; d < 4; ++d) {
+            Encoder enc = encoder_create();
+            enc.init(&enc, &_tim2_cfg, periods[p], 15.518f);
+            _tim2.CNT = 0;
+            _tim2.SR = 0;
+            _true_count = 0;
+            enc.update(&enc);
+            count(deltas[d]);
+            enc.update(&enc);
+            run_isr();
+            double expect = deltas[d] * (1000.0 / 15.518) * 1000.0 / periods[p];
+            TEST_CHECK(fabs(enc.get_speed_um_s(&enc) - expect) <= fabs(expect) * 1e-4 + 1.0,
+                "period %d ms, %d pulses: speed %d um/s, expected %.0f", periods[p], (int)deltas[d],
+                (int)enc.get_speed_um_s(&enc), expect);
+        }
+    }
+}
+
+/**
+ * @brief   上下行系数不同: 位置是计数的函数, 与经过的路径无关
+ */
+static void test_two_scales(void) {
+    Encoder enc;
+    encoder_start(&enc, 1000);
+    enc.set_scale(&enc, 15.0f, 16.0f);
+    count(5000);
+    enc.update(&enc);
+    int32_t at = enc.get_position_um(&enc);
+    TEST_NEAR(at, 5000 * 1000.0 / 15.0, 1.0, "two scales: position above origin");
+
+    /* 静止时 ±1 脉冲抖动 */
+    for(int i = 0; i < 1000; ++i) {
+        count((i & 1) ? -1 : 1);
+        enc.update(&enc);
+        run_isr();
+    }
+    TEST_CHECK(enc.get_position_um(&enc) == at, "two scales: jitter drifted %d -> %d um", (int)at, (int)enc.get_position_um(&enc));
+
+    /* 来回走不同的路径回到同一计数 */
+    static const int32_t path[] = {-3000, 1200, -7000, 2500, 300, 6000};
+    for(unsigned i = 0; i < sizeof(path) / sizeof(path[0]); ++i) {
+        count(path[i]);
+        enc.update(&enc);
+        run_isr();
+    }
+    TEST_CHECK(enc.get_position_um(&enc) == at, "two scales: path changed position %d -> %d um", (int)at, (int)enc.get_position_um(&enc));
+
+    /* 零点下方用下行系数 */
+    count(-8000);
+    enc.update(&enc);
+    TEST_NEAR(enc.get_position_um(&enc), -3000 * 1000.0 / 16.0, 1.0, "two scales: position below origin");
+}
+
+/**
+ * @brief   以 10 ms 周期运行 n 个周期, 位置为 x(t) (mm), 计数为其量化值
+ * @param   v 每周期的速度 (mm/s) 输出, 可为 0
+ * @param   a 每周期的加速度 (mm/s^2) 输出, 可为 0
+ */
+static void run_motion(Encoder* enc, double (*x)(double), int n, float* v, float* a) {
+    int64_t base = _true_count;
+    for(int i = 1; i <= n; ++i) {
+        int64_t target = base + (int64_t)floor(x(i * 0.01) * 15.518);
+        count((int32_t)(target - _true_count));
+        enc->update(enc);
+        run_isr();
+        if(v) v[i - 1] = enc->get_speed(enc);
+        if(a) a[i - 1] = enc->get_accel(enc);
+    }
+}
+
+static double x_steady(double t) { return 2.0 * t; }
+static double x_ramp(double t) { return 25.0 * t * t; }
+
+/**
+ * @brief   α-β-γ 观测器: 增益 (三重极点 p = exp(-2π·bw·T)), 低速平滑, 匀加速跟踪
+ */
+static void test_observer(void) {
+    static float v[1000], a[1000];
+    Encoder enc;
+
+    /* 增益: 5 Hz / 100 Hz */
+    encoder_start(&enc, 0);
+    enc.set_speed_mode(&enc, EncoderSpeedObserver, 5.0f);
+    double p = exp(-2.0 * 3.14159265 * 5.0 / 100.0), q = 1.0 - p;
+    TEST_NEAR(enc._obs_alpha_q16_ / 65536.0, 1.0 - p * p * p, 1e-4, "alpha");
+    TEST_NEAR(enc._obs_beta_q16_ / 65536.0, 1.5 * q * q * (1.0 + p), 1e-4, "beta");
+    TEST_NEAR(enc._obs_gamma2_q16_ / 65536.0, q * q * q, 1e-4, "2 gamma");
+
+    /* 带宽上限: 更新频率的 1/4 */
+    Encoder lim;
+    encoder_start(&lim, 0);
+    lim.set_speed_mode(&lim, EncoderSpeedObserver, 80.0f);
+    p = exp(-2.0 * 3.14159265 * 0.25);
+    TEST_NEAR(lim._obs_alpha_q16_ / 65536.0, 1.0 - p * p * p, 1e-4, "alpha at bandwidth limit");
+
+    /* 2 mm/s 匀速 (约 0.3 脉冲 / 周期): 周期差分只有 0 与 6.4 mm/s 两档, 观测器连续且均值准确 */
+    run_motion(&enc, x_steady, 1000, v, 0);
+    double sum = 0.0, vmin = 1e9, vmax = -1e9;
+    for(int i = 200; i < 1000; ++i) {
+        sum += v[i];
+        if(v[i] < vmin) vmin = v[i];
+        if(v[i] > vmax) vmax = v[i];
+    }
+    printf("observer 2 mm/s: mean %.3f, range %.2f .. %.2f mm/s\n", sum / 800.0, vmin, vmax);
+    TEST_NEAR(sum / 800.0, 2.0, 0.05, "observer mean speed at 2 mm/s");
+    TEST_CHECK(vmin > 1.0 && vmax < 3.0, "observer speed at 2 mm/s ranges %.2f .. %.2f", vmin, vmax);
+
+    Encoder diff;
+    encoder_start(&diff, 0);
+    run_motion(&diff, x_steady, 1000, v, 0);
+    int levels_ok = 1;
+    for(int i = 200; i < 1000; ++i) {
+        if(fabsf(v[i]) > 0.01f && fabsf(v[i] - 6.444f) > 0.01f) levels_ok = 0;
+    }
+    TEST_CHECK(levels_ok, "window difference at 2 mm/s should only read 0 or 6.44 mm/s");
+
+    /* 50 mm/s^2 匀加速: 三阶观测器对匀加速无稳态滞后 */
+    Encoder ramp;
+    encoder_start(&ramp, 0);
+    ramp.set_speed_mode(&ramp, EncoderSpeedObserver, 5.0f);
+    run_motion(&ramp, x_ramp, 200, v, a);
+    // 1 s 后: 误差只剩量化噪声 (均值即滞后, 应接近 0)
+    double err_sum = 0.0, err_max = 0.0, acc_sum = 0.0;
+    for(int i = 100; i < 200; ++i) {
+        double e = v[i] - 50.0 * (i + 1) * 0.01;
+        err_sum += e;
+        if(fabs(e) > err_max) err_max = fabs(e);
+        acc_sum += a[i];
+    }
+    printf("observer 50 mm/s^2 ramp: speed error mean %+.3f, max %.2f mm/s; accel mean %.1f mm/s^2\n",
+        err_sum / 100.0, err_max, acc_sum / 100.0);
+    TEST_NEAR(err_sum / 100.0, 0.0, 0.2, "observer mean speed error on ramp");
+    TEST_CHECK(err_max < 1.5, "observer ramp speed error %.2f mm/s", err_max);
+    TEST_NEAR(acc_sum / 100.0, 50.0, 5.0, "observer mean accel on ramp");
+}
+
+// ! ========================= 接 口 函 数 实 现 ========================= ! //
+
+int main(void) {
+    test_wraps();
+    test_dither();
+    test_race();
+    test_update_continuity();
+    test_short_period();
+    test_two_scales();
+    test_observer();
+    return TEST_RESULT("test_encoder");
+}
@@ -0,0 +1,95 @@
+/**
+ * @file    test_lift_autotune.c
+ * @brief   继电反馈自整定: 积分 + 纯滞后对象上的极限环与整定结果
+ * @note    对象: 继电器接通时 ±40 mm/s, 纯滞后 80 ms, 10 ms 周期. 极限环为三角波,
+ *          振幅 a ≈ h + v · L (另加最多一个周期的检测延迟), 周期 Tu = 4a / v
+ */
+#include "test.h"
+#include "s_lift_autotune.h"
+
+#include <string.h>
+
+// ! ========================= 变 量 声 明 ========================= ! //
+
+#define TICK_MS         10u
+#define SPEED_MM_S      40.0
+#define DELAY_TICKS     8
+#define HYST_MM         0.5f
+
+static double _x;
+static int8_t _hist[DELAY_TICKS];
+static unsigned _hi;
+
+// ! ========================= 私 有 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   运行整定直到结束, 返回结束时间 (ms)
+ */
+static uint32_t run(float sp, float lo, float hi, LiftTuneRule_e rule) {
+    uint32_t now = 0;
+    _x = sp;
+    _hi = 0;
+    memset(_hist, 0, sizeof(_hist));
+
+    s_lift_autotune_start(sp, HYST_MM, 1.0f, 4, rule, lo, hi, now);
+    while(s_lift_autotune_status() == LiftTuneRunning) {
+        now += TICK_MS;
+        int8_t dir = s_lift_autotune_update((float)_x, now);
+        int8_t applied = _hist[_hi % DELAY_TICKS];
+        _hist[_hi % DELAY_TICKS] = dir;
+        ++_hi;
+        _x += applied * SPEED_MM_S * TICK_MS * 0.001;
+    }
+    return now;
+}
+
+// ! ========================= 接 口 函 数 实 现 ========================= ! //
+
+int main(void) {
+    lift_tune_result_t zn, tl;
+    const double a_min = HYST_MM + SPEED_MM_S * DELAY_TICKS * TICK_MS * 0.001;
+    const double a_max = a_min + SPEED_MM_S * TICK_MS * 0.001;
+
+    run(100.0f, 80.0f, 120.0f, LiftTuneRuleZN);
+    TEST_CHECK(s_lift_autotune_result(&zn), "ZN failed, err %d", (int)s_lift_autotune_error());
+    TEST_CHECK(zn.amp_mm >= a_min - 0.05 && zn.amp_mm <= a_max + 0.05, "amplitude %.3f mm, expected %.2f ~ %.2f",
+        zn.amp_mm, a_min, a_max);
+    TEST_NEAR(zn.tu_s, 4.0 * zn.amp_mm / SPEED_MM_S, 0.02, "Tu = 4a / v");
+    TEST_NEAR(zn.ku, 4.0 / (3.14159265 * sqrt(zn.amp_mm * zn.amp_mm - HYST_MM * HYST_MM)), 1e-5, "Ku");
+    TEST_NEAR(zn.kp, 0.6 * zn.ku, 1e-6, "ZN kp");
+    TEST_NEAR(zn.ki, zn.kp / (0.5 * zn.tu_s), 1e-4, "ZN ki");
+    TEST_NEAR(zn.kd, zn.kp * 0.125 * zn.tu_s, 1e-6, "ZN kd");
+
+    /* 同一对象, Tyreus-Luyben 更保守 */
+    run(100.0f, 80.0f, 120.0f, LiftTuneRuleTL);
+    TEST_CHECK(s_lift_autotune_result(&tl), "TL failed, err %d", (int)s_lift_autotune_error());
+    TEST_NEAR(tl.ku, zn.ku, 1e-4, "TL Ku");
+    TEST_NEAR(tl.kp, tl.ku / 3.2, 1e-6, "TL kp");
+    TEST_NEAR(tl.ki, tl.kp / (2.2 * tl.tu_s), 1e-5, "TL ki");
+    TEST_CHECK(tl.kp < zn.kp && tl.ki < zn.ki, "TL not more conservative than ZN");
+
+    /* 振荡超出允许范围 */
+    run(100.0f, 98.0f, 102.0f, LiftTuneRuleTL);
+    TEST_CHECK(s_lift_autotune_status() == LiftTuneFailed && s_lift_autotune_error() == LiftTuneErrRange,
+        "range: status %d err %d", (int)s_lift_autotune_status(), (int)s_lift_autotune_error());
+    TEST_CHECK(!s_lift_autotune_result(&tl), "result valid after failure");
+
+    /* 设定点不在范围内: 立即失败 */
+    s_lift_autotune_start(100.0f, HYST_MM, 1.0f, 4, LiftTuneRuleTL, 100.0f, 120.0f, 0);
+    TEST_CHECK(s_lift_autotune_error() == LiftTuneErrRange, "setpoint on the limit accepted");
+    TEST_CHECK(s_lift_autotune_update(100.0f, 10) == 0, "drives after failure");
+
+    /* 中止 */
+    s_lift_autotune_start(100.0f, HYST_MM, 1.0f, 4, LiftTuneRuleTL, 80.0f, 120.0f, 0);
+    TEST_CHECK(s_lift_autotune_update(100.0f, 10) == 1, "first output not up");
+    s_lift_autotune_abort();
+    TEST_CHECK(s_lift_autotune_error() == LiftTuneErrAborted, "abort err %d", (int)s_lift_autotune_error());
+
+    /* 对象不动: 超时 */
+    s_lift_autotune_start(100.0f, HYST_MM, 1.0f, 4, LiftTuneRuleTL, 80.0f, 120.0f, 0);
+    s_lift_autotune_update(100.0f, LIFT_TUNE_TIMEOUT_MS + 10);
+    TEST_CHECK(s_lift_autotune_error() == LiftTuneErrTimeout, "timeout err %d", (int)s_lift_autotune_error());
+
+    printf("ZN: a %.2f mm, Tu %.3f s, Ku %.3f, kp %.3f ki %.3f kd %.4f\n", zn.amp_mm, zn.tu_s, zn.ku, zn.kp, zn.ki, zn.kd);
+    return TEST_RESULT("test_lift_autotune");
+}
@@ -0,0 +1,172 @@
+/**
+ * @file    test_lift_coast.c
+ * @brief   停车惯性模型: 滑行系数学习, 提前断开继电器的 1 mm 到位
+ * @note    对象: 继电器释放延时 30 ms, 满速上行 40 / 下行 60 mm/s, 驱动时 τ 0.12 s,
+ *          断开后滑行 τ 上行 0.12 s / 下行 0.30 s (重力); 编码器 15.518 脉冲/mm 量化.
+ *          定位逻辑同 a_fsm.c (LIFT_POS_CTRL_PID = 0): 剩余距离不大于到位带或预测滑行距离时断开,
+ *          滑行结束仍超出到位带则再次定位. 同一组目标重复 6 轮, 统计最后 10 次
+ */
+#include "test.h"
+#include "s_lift_coast.h"
+
+// ! ========================= 变 量 声 明 ========================= ! //
+
+#define TICK_S          0.01
+#define PULSE_PER_MM    15.518
+#define MOVES           60
+#define SCORED          10
+
+// 同 a_board.c lift_coast_cfg
+static const lift_coast_cfg_t lift_coast_cfg = {
+    .k_up_s = 0.15f,
+    .k_down_s = 0.15f,
+    .learn_rate = 0.3f,
+    .lead_s = 0.08f,
+    .min_speed_mm_s = 20.0f,
+    .still_speed_mm_s = 1.0f,
+    .still_ticks = 10,
+    .timeout_ticks = 200,
+};
+
+static const float _targets[] = {100, 40, 150, 20, 120, 60, 180, 10, 90, 30};
+
+static double _x, _v;
+static int _relay, _applied, _delay;
+
+typedef enum {
+    BandFixed5 = 0,                 // 固定 5 mm 到位带
+    BandFixed1,                     // 固定 1 mm 到位带
+    BandPredict                     // 1 mm 到位带 + 预测滑行提前断开
+} Band_e;
+
+typedef struct {
+    double total_s;                 // 计分段调节时间之和
+    double max_err_mm;              // 计分段最大终值误差
+    int reversals;                  // 计分段换向次数
+    int timeouts;                   // 计分段未到位次数
+} result_t;
+
+// ! ========================= 私 有 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   对象前进一个周期 (内部 1 ms 积分), 继电器指令延时 3 个周期生效
+ */
+static void plant_step(void) {
+    for(int i = 0; i < 10; ++i) {
+        double h = TICK_S / 10.0;
+        double vt = (_applied > 0) ? 40.0 : (_applied < 0) ? -60.0 : 0.0;
+        double tau = _applied ? 0.12 : (_v > 0.0 ? 0.12 : 0.30);
+        _v += (vt - _v) * h / tau;
+        if(!_applied && fabs(_v) < 0.3) _v = 0.0;
+        _x += _v * h;
+    }
+    if(_relay != _applied) {
+        if(++_delay >= 3) {
+            _applied = _relay;
+            _delay = 0;
+        }
+    }
+    else {
+        _delay = 0;
+    }
+}
+
+/**
+ * @brief   按给定到位方式运行全部定位
+ */
+static result_t run(Band_e band) {
+    result_t r = {0.0, 0.0, 0, 0};
+    float b = (band == BandFixed5) ? 5.0f : 1.0f;
+    double vf = 0.0, af = 0.0;
+    int moving = 0;
+
+    _x = _v = 0.0;
+    _relay = _applied = _delay = 0;
+    s_lift_coast_init(&lift_coast_cfg);
+
+    for(int m = 0; m < MOVES; ++m) {
+        float target = _targets[m % 10];
+        int t, reversals = 0, last = 0, still = 0;
+        double pos = 0.0;
+        for(t = 0; t < 3000; ++t) {
+            plant_step();
+            pos = floor(_x * PULSE_PER_MM) / PULSE_PER_MM;
+            double vp = vf;
+            vf += (_v - vf) * 0.2;
+            af += ((vf - vp) / TICK_S - af) * 0.3;
+            s_lift_coast_update((int8_t)_relay, (float)pos, (float)vf);
+
+            float err = target - (float)pos;
+            if(band == BandPredict) {
+                if(!moving && fabsf(err) > b && fabs(vf) <= 1.0 && s_lift_coast_settled()) moving = 1;
+                if(moving) {
+                    int8_t dir = (err > 0.0f) ? 1 : -1;
+                    float coast = s_lift_coast_predict(dir, (float)vf, (float)af);
+                    if(fabsf(err) <= b || fabsf(err) <= coast) {
+                        _relay = 0;
+                        moving = 0;
+                    }
+                    else {
+                        _relay = dir;
+                    }
+                }
+            }
+            else {
+                if(!moving && fabsf(err) > b) moving = 1;
+                if(moving) {
+                    if(err > b) _relay = 1;
+                    else if(err < -b) _relay = -1;
+                    else {
+                        _relay = 0;
+                        moving = 0;
+                    }
+                }
+            }
+
+            if(_relay && last && _relay != last) reversals++;
+            if(_relay) last = _relay;
+            still = (!moving && _v == 0.0 && !_applied && fabs(vf) < 0.5) ? still + 1 : 0;
+            if(still >= 15 && fabs(target - pos) <= b) {
+                t -= 15;
+                break;
+            }
+        }
+
+        if(m >= MOVES - SCORED) {
+            r.total_s += t * TICK_S;
+            r.reversals += reversals;
+            if(t >= 3000) r.timeouts++;
+            if(fabs(_x - target) > r.max_err_mm) r.max_err_mm = fabs(_x - target);
+        }
+    }
+    return r;
+}
+
+// ! ========================= 接 口 函 数 实 现 ========================= ! //
+
+int main(void) {
+    /* 未初始化时不预测滑行 */
+    TEST_CHECK(s_lift_coast_predict(1, 30.0f, 0.0f) == 0.0f, "predict before init");
+
+    static const char* names[] = {"fixed 5 mm band", "fixed 1 mm band", "predictive 1 mm"};
+    result_t r[3];
+    for(int b = 0; b < 3; ++b) {
+        r[b] = run((Band_e)b);
+        printf("%-16s: last %d moves %7.2f s, max error %.2f mm, %d reversals, %d timeouts\n",
+            names[b], SCORED, r[b].total_s, r[b].max_err_mm, r[b].reversals, r[b].timeouts);
+    }
+
+    /* 预测方式学习到的滑行系数: 滑行 τ + 释放延时 (上行约 0.15 s, 下行因重力约 0.33 s) */
+    printf("learned k: up %.3f s, down %.3f s\n", s_lift_coast_get_k(1), s_lift_coast_get_k(-1));
+    TEST_NEAR(s_lift_coast_get_k(1), 0.15, 0.03, "k_up");
+    TEST_NEAR(s_lift_coast_get_k(-1), 0.33, 0.05, "k_down");
+
+    /* 固定 1 mm 到位带时来回振荡不能到位, 预测方式全部进入 1 mm; 固定 5 mm 到位带更快但误差超过 1 mm */
+    TEST_CHECK(r[BandFixed1].timeouts > 0, "fixed 1 mm band expected to hunt");
+    TEST_CHECK(r[BandPredict].timeouts == 0, "predictive: %d moves not settled", r[BandPredict].timeouts);
+    TEST_CHECK(r[BandPredict].max_err_mm <= 1.0, "predictive: max error %.2f mm", r[BandPredict].max_err_mm);
+    TEST_CHECK(r[BandPredict].reversals <= 3, "predictive: %d reversals", r[BandPredict].reversals);
+    TEST_CHECK(r[BandFixed5].max_err_mm > 1.0, "fixed 5 mm band: max error %.2f mm", r[BandFixed5].max_err_mm);
+
+    return TEST_RESULT("test_lift_coast");
+}
@@ -0,0 +1,321 @@
+/**
+ * @file    test_lift_ctrl.c
+ * @brief   升降台定位闭环仿真: 板上默认参数在含重力、摩擦与纯滞后的对象上应能到位
+ * @note    对象: 一阶惯性 τ 0.1 s, 满占空比速度上行 40 / 下行 46 mm/s, 重力偏置 0.12,
+ *          库仑摩擦 0.1, 起步静摩擦 0.2, 继电器断开后按摩擦滑行; 纯滞后继电器 80 ms (吸合 + 电机起动),
+ *          PWM 20 ms; 编码器 15.518 脉冲/mm 量化. PID / 控制 / 轨迹 / 前馈辨识参数同 a_board.c.
+ *          继电器与 PWM 两种驱动, 位置式与增量式 PID, 不带与带前馈模型 (先在对象上辨识), 以及 PWM 串级
+ *          (LIFT_CTRL_CASCADE) 各跑 10 次定位, 每次都应在 a_fsm.c 的定位超时 (5 s + 行程 / 10 mm/s) 内报告到位;
+ *          带前馈模型时跟踪误差均方根与总调节时间都应小于不带前馈;
+ *          静止保持时加 0.3 占空比的负载阶跃, 串级的位置偏差应小于单环
+ */
+#include "test.h"
+#include "s_lift_ctrl.h"
+#include "s_lift_profile.h"
+#include "s_lift_ff.h"
+
+#include <string.h>
+
+// ! ========================= 变 量 声 明 ========================= ! //
+
+#define TICK_S              0.01
+#define PULSE_PER_MM        15.518
+#define DELAY_TICKS         8               // 继电器
+#define DELAY_TICKS_PWM     2
+#define MOVE_TIMEOUT_S(d)   (5.0 + fabs(d) / 10.0)
+
+static const double _tau = 0.1, _k_up = 40.0, _k_dn = 46.0, _gravity = 0.12, _fc = 0.1, _fs = 0.2;
+
+static int _pwm;
+static double _x, _v, _vf, _xq_prev, _load;
+static float _hist[DELAY_TICKS + 1];
+static int _hi;
+
+// 同 a_board.c lift_pid_cfg
+static const pid_cfg_t lift_pid_cfg = {
+    .mode = PID_MODE_PID,
+    .features = PID_FEAT_OUTPUT_LIMIT | PID_FEAT_ANTI_WINDUP | PID_FEAT_INTEGRAL_SEP
+        | PID_FEAT_DEADBAND | PID_FEAT_DIFF_FILTER | PID_FEAT_FEEDFORWARD,
+    .kp = 0.2f,
+    .ki = 0.05f,
+    .kd = 0.06f,
+    .max_out = 1.0f,
+    .integral_separation = 5.0f,
+    .dead_band = 0.5f,
+    .diff_filter_alpha = 0.3f,
+    .output_max_rate = 0.0f,
+};
+
+// 同 a_board.c lift_cascade_pos_cfg
+static const pid_cfg_t lift_cascade_pos_cfg = {
+    .mode = PID_MODE_PI,
+    .features = PID_FEAT_OUTPUT_LIMIT | PID_FEAT_ANTI_WINDUP | PID_FEAT_DEADBAND | PID_FEAT_FEEDFORWARD,
+    .kp = 4.0f,
+    .ki = 0.5f,
+    .kd = 0.0f,
+    .max_out = 40.0f,
+    .integral_separation = 0.0f,
+    .dead_band = 0.5f,
+    .diff_filter_alpha = 1.0f,
+    .output_max_rate = 0.0f,
+};
+
+// 同 a_board.c lift_cascade_vel_cfg
+static const pid_cfg_t lift_cascade_vel_cfg = {
+    .mode = PID_MODE_PI | PID_MODE_INCREMENTAL,
+    .features = PID_FEAT_OUTPUT_LIMIT | PID_FEAT_FEEDFORWARD,
+    .kp = 0.04f,
+    .ki = 0.3f,
+    .kd = 0.0f,
+    .max_out = 1.0f,
+    .integral_separation = 0.0f,
+    .dead_band = 0.0f,
+    .diff_filter_alpha = 1.0f,
+    .output_max_rate = 0.0f,
+};
+
+// 同 a_board.c lift_profile_cfg
+static const lift_profile_cfg_t lift_profile_cfg = {
+    .v_max = 30.0f,
+    .a_max = 100.0f,
+    .j_max = 1000.0f,
+    .tick_s = 0.01f,
+};
+
+// 同 a_board.c lift_ff_cfg
+static const lift_ff_cfg_t lift_ff_cfg = {
+    .still_mm_s = 1.0f,
+    .blend_mm_s = 1.0f,
+    .speed_mm_s = {12.0f, 20.0f, 28.0f},
+    .settle_s = 1.0f,
+    .measure_s = 1.0f,
+    .still_s = 0.5f,
+    .travel_mm = 80.0f,
+    .ramp_per_s = 0.3f,
+    .move_mm = 0.3f,
+    .u0_s_mm = 1.0f / 40.0f,
+    .kp = 0.01f,
+    .ki = 0.1f,
+};
+
+// ! ========================= 私 有 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   对象复位到 pos_mm 静止
+ */
+static void plant_reset(double pos_mm) {
+    _x = pos_mm;
+    _v = 0.0;
+    _vf = 0.0;
+    _load = 0.0;
+    _hi = 0;
+    memset(_hist, 0, sizeof(_hist));
+    _xq_prev = floor(_x * PULSE_PER_MM) / PULSE_PER_MM;
+}
+
+/**
+ * @brief   对象前进一个周期 (内部 1 ms 积分)
+ * @param   u 本周期指令, 纯滞后后生效
+ */
+static void plant_step(float u) {
+    _hist[_hi % (DELAY_TICKS + 1)] = u;
+    ++_hi;
+    int delay = _pwm ? DELAY_TICKS_PWM : DELAY_TICKS;
+    double a = (_hi > delay) ? _hist[(_hi - 1 - delay) % (DELAY_TICKS + 1)] : 0.0;
+
+    for(int i = 0; i < 10; ++i) {
+        double h = TICK_S / 10.0;
+        if(a == 0.0 && !_pwm) {
+            // 继电器断开: 电机无制动, 按摩擦减速滑行
+            double dv = -(_v > 0.0 ? 1.0 : -1.0) * (_k_up * _fc + fabs(_v)) * h / _tau;
+            _v = (fabs(dv) >= fabs(_v)) ? 0.0 : _v + dv;
+            _x += _v * h;
+            continue;
+        }
+        double net = a - _gravity - _load;
+        if(_v == 0.0 && fabs(net) <= _fs) continue;
+        double sg = (_v != 0.0) ? (_v > 0.0 ? 1.0 : -1.0) : (net > 0.0 ? 1.0 : -1.0);
+        double k = (sg > 0.0) ? _k_up : _k_dn;
+        double nv = _v + (k * (net - sg * _fc) - _v) * h / _tau;
+        if(_v != 0.0 && nv * _v < 0.0) nv = 0.0;
+        _v = nv;
+        _x += _v * h;
+    }
+}
+
+/**
+ * @brief   编码器量化后的位置
+ */
+static float plant_pos(void) {
+    return (float)(floor(_x * PULSE_PER_MM) / PULSE_PER_MM);
+}
+
+/**
+ * @brief   编码器速度 (周期差分 + 一阶滤波, 每周期调用一次)
+ */
+static float plant_speed(void) {
+    double p = plant_pos();
+    _vf += ((p - _xq_prev) / TICK_S - _vf) * 0.3;
+    _xq_prev = p;
+    return (float)_vf;
+}
+
+/**
+ * @brief   按驱动方式与控制结构初始化对象与控制器
+ * @param   pwm 0:继电器时间比例 1:PWM
+ * @param   incremental 增量式 PID (单环)
+ * @param   cascade 串级
+ */
+static void ctrl_init(int pwm, int incremental, int cascade) {
+    // 同 a_board.c lift_ctrl_cfg
+    static lift_ctrl_cfg_t cc;
+    cc = (lift_ctrl_cfg_t){
+        .window_ticks = pwm ? 0 : 10,
+        .min_on_ticks = pwm ? 0 : 4,
+        .period_s = 0.01f,
+        .vff_s_mm = 1.0f / 40.0f,
+        .outer_div = 2,
+        .settle_band_mm = 1.0f,
+        .settle_hold_s = 0.5f,
+    };
+
+    static pid_cfg_t pc;
+    pc = lift_pid_cfg;
+    if(incremental) pc.mode |= PID_MODE_INCREMENTAL;
+
+    _pwm = pwm;
+    plant_reset(100.0);
+    if(cascade) s_lift_ctrl_init(&cc, &lift_cascade_pos_cfg, &lift_cascade_vel_cfg);
+    else s_lift_ctrl_init(&cc, &pc, 0);
+    s_lift_ff_init(&lift_ff_cfg);
+    s_lift_profile_init(&lift_profile_cfg);
+}
+
+/**
+ * @brief   在对象上辨识前馈模型并启用
+ */
+static void ident_ff(void) {
+    s_lift_ff_ident_start(plant_pos(), 1000.0f, (float)_tau);
+
+    float u = 0.0f;
+    for(int t = 0; t < 5000 && s_lift_ff_ident_status() == LiftFfIdentRunning; ++t) {
+        plant_step(u);
+        float speed = plant_speed();
+        u = s_lift_ctrl_output(s_lift_ff_ident_update(plant_pos(), speed, (float)TICK_S));
+    }
+
+    lift_ff_model_t m;
+    TEST_CHECK(s_lift_ff_ident_result(&m), "ff ident failed, err %d", (int)s_lift_ff_ident_error());
+    // 继电器方式的模型含时间比例与滑行的折算, 只有 PWM 方式与对象参数直接可比
+    if(_pwm) TEST_NEAR(m.gravity, _gravity, 0.03, "ff gravity");
+    TEST_CHECK(s_lift_ff_set_model(&m), "ff model rejected");
+}
+
+/**
+ * @brief   控制并推进对象一个周期
+ */
+static void ctrl_step(float target) {
+    float pos = plant_pos(), speed = plant_speed();
+    plant_step(s_lift_ctrl_update(target, s_lift_profile_pos(), s_lift_profile_vel(), s_lift_profile_acc(), pos, speed,
+        (float)TICK_S));
+}
+
+/**
+ * @brief   PWM 驱动在 100 mm 静止保持, 1 s 后加 0.3 占空比负载, 返回其后的最大位置偏差, 10 s 内应回到 ±1 mm
+ */
+static double load_step(int cascade) {
+    ctrl_init(1, 0, cascade);
+    s_lift_profile_reset(100.0f, 0.0f);
+    s_lift_profile_set_target(100.0f);
+    s_lift_ctrl_start(100.0f, 100.0f, 0.0f, 0.0f, 0.0f);
+
+    double dev = 0.0;
+    for(int t = 0; t < 1100; ++t) {
+        if(t == 100) _load = 0.3;
+        s_lift_profile_update();
+        ctrl_step(100.0f);
+        if(t >= 100 && fabs(_x - 100.0) > dev) dev = fabs(_x - 100.0);
+    }
+    TEST_CHECK(fabs(_x - 100.0) <= 1.0, "%s: load step not recovered (err %.2f mm)",
+        cascade ? "cascade" : "single", _x - 100.0);
+    return dev;
+}
+
+/**
+ * @brief   10 次定位, 每次都应在定位超时内到位
+ * @param   pwm 0:继电器时间比例 1:PWM
+ * @param   incremental 增量式 PID (单环)
+ * @param   cascade 串级
+ * @param   use_ff 使用辨识出的前馈模型
+ * @param   total_s 总调节时间输出
+ * @param   rms_mm 跟踪误差均方根输出
+ */
+static void run_moves(int pwm, int incremental, int cascade, int use_ff, double* total_s, double* rms_mm) {
+    static const float targets[] = {150, 90, 200, 60, 170, 110, 230, 40, 130, 70};
+    const char* name = cascade ? "cascade" : (incremental ? "inc" : "pos");
+    ctrl_init(pwm, incremental, cascade);
+    if(use_ff) {
+        ident_ff();
+        plant_reset(100.0);     // 辨识在上方行程内往返, 定位序列从同一起点开始
+    }
+
+    double max_over = 0.0, sq = 0.0;
+    *total_s = 0.0;
+    for(unsigned mv = 0; mv < sizeof(targets) / sizeof(targets[0]); ++mv) {
+        float target = targets[mv];
+        float pos = plant_pos(), speed = plant_speed();
+        double limit_s = MOVE_TIMEOUT_S(target - pos);
+        s_lift_profile_reset(pos, speed);
+        s_lift_profile_set_target(target);
+        s_lift_ctrl_start(target, pos, speed, s_lift_profile_vel(), 0.0f);
+
+        bool settled = false;
+        for(int t = 0; t * TICK_S < limit_s && !settled; ++t) {
+            bool done = s_lift_profile_update();
+            ctrl_step(target);
+            settled = done && s_lift_ctrl_settled();
+        }
+
+        lift_ctrl_stats_t st;
+        s_lift_ctrl_stats(&st);
+        TEST_CHECK(settled, "%s %s ff %d: move to %.0f not settled in %.1f s (err %.2f mm)",
+            pwm ? "pwm" : "relay", name, use_ff, target, limit_s, st.final_err_mm);
+        TEST_CHECK(fabsf(st.final_err_mm) <= 1.0f, "%s %s ff %d: move to %.0f: final error %.2f mm",
+            pwm ? "pwm" : "relay", name, use_ff, target, st.final_err_mm);
+        *total_s += st.settle_s;
+        sq += st.rms_err_mm * st.rms_err_mm;
+        if(st.overshoot_mm > max_over) max_over = st.overshoot_mm;
+
+        for(int k = 0; k < 100; ++k) {
+            plant_step(0.0f);
+            plant_speed();
+        }
+    }
+    *rms_mm = sqrt(sq / (sizeof(targets) / sizeof(targets[0])));
+    printf("%-5s %s ff %d: total settle %.2f s, tracking rms %.2f mm, max overshoot %.2f mm\n", pwm ? "pwm" : "relay",
+        name, use_ff, *total_s, *rms_mm, max_over);
+}
+
+// ! ========================= 接 口 函 数 实 现 ========================= ! //
+
+int main(void) {
+    for(int pwm = 0; pwm < 2; ++pwm) {
+        for(int inc = 0; inc < 2; ++inc) {
+            double total_s[2], rms_mm[2];
+            for(int ff = 0; ff < 2; ++ff) {
+                run_moves(pwm, inc, 0, ff, &total_s[ff], &rms_mm[ff]);
+            }
+            TEST_CHECK(rms_mm[1] < rms_mm[0], "%s %s: ff tracking rms %.2f mm, without %.2f mm",
+                pwm ? "pwm" : "relay", inc ? "inc" : "pos", rms_mm[1], rms_mm[0]);
+            TEST_CHECK(total_s[1] < total_s[0], "%s %s: ff total settle %.2f s, without %.2f s",
+                pwm ? "pwm" : "relay", inc ? "inc" : "pos", total_s[1], total_s[0]);
+        }
+    }
+    double total_s, rms_mm;
+    run_moves(1, 0, 1, 0, &total_s, &rms_mm);
+
+    double dev_single = load_step(0), dev_cascade = load_step(1);
+    printf("load step: deviation single %.2f mm, cascade %.2f mm\n", dev_single, dev_cascade);
+    TEST_CHECK(dev_cascade < dev_single, "cascade deviation %.2f mm, single loop %.2f mm", dev_cascade, dev_single);
+    return TEST_RESULT("test_lift_ctrl");
+}
@@ -0,0 +1,89 @@
+/**
+ * @file    test_lift_gains.c
+ * @brief   增益调度: 断点间线性插值与端点钳位, 未启用时取基准增益, 方向 / 负载切换时按时间过渡
+ * @note    参数同 a_board.c lift_gains_cfg (τ 0.2 s, 3τ ≈ 0.6 s 过渡), 10 ms 周期
+ */
+#include "test.h"
+#include "s_lift_gains.h"
+
+// ! ========================= 变 量 声 明 ========================= ! //
+
+#define DT_S        0.01f
+
+static const lift_gains_cfg_t lift_gains_cfg = {
+    .blend_tau_s = 0.2f,
+    .dir_speed_mm_s = 1.0f,
+};
+
+static lift_gain_table_t _table;
+
+// ! ========================= 接 口 函 数 实 现 ========================= ! //
+
+int main(void) {
+    const lift_gains_t base = { 0.2f, 0.05f, 0.06f };
+    lift_gains_t g;
+
+    /* 未启用: 查表与周期处理都取基准增益, 不能修改表项 */
+    s_lift_gains_init(&lift_gains_cfg, &_table, false);
+    s_lift_gains_set_base(&base);
+    s_lift_gains_lookup(-1, LiftLoadHeld, 150.0f, &g);
+    TEST_CHECK(g.kp == base.kp && g.ki == base.ki && g.kd == base.kd, "disabled lookup kp %.3f", g.kp);
+    TEST_NEAR(s_lift_gains_update(-30.0f, 150.0f, DT_S)->kp, base.kp, 1e-6, "disabled update");
+    TEST_CHECK(!s_lift_gains_set(1, LiftLoadEmpty, 0, &base), "set accepted while disabled");
+
+    /* 启用: 断点均布 0 / 150 / 300 mm, 整张表为基准增益 */
+    s_lift_gains_enable(0.0f, 300.0f);
+    TEST_CHECK(_table.pos_mm[1] == 150.0f, "middle breakpoint %.1f", _table.pos_mm[1]);
+    s_lift_gains_lookup(-1, LiftLoadHeld, 200.0f, &g);
+    TEST_NEAR(g.kp, base.kp, 1e-6, "table filled with base");
+
+    /* 上行空载: kp 0.1 / 0.3 / 0.5, 断点间线性插值, 断点外钳位到端点 */
+    const float up_kp[LIFT_GAINS_POINTS] = { 0.1f, 0.3f, 0.5f };
+    for(uint8_t i = 0; i < LIFT_GAINS_POINTS; ++i) {
+        lift_gains_t e = { up_kp[i], 0.05f, 0.06f };
+        TEST_CHECK(s_lift_gains_set(1, LiftLoadEmpty, i, &e), "set %u rejected", (unsigned)i);
+    }
+    TEST_CHECK(!s_lift_gains_set(1, LiftLoadEmpty, LIFT_GAINS_POINTS, &base), "index out of range accepted");
+    s_lift_gains_lookup(1, LiftLoadEmpty, 75.0f, &g);
+    TEST_NEAR(g.kp, 0.2, 1e-6, "interpolated at 75 mm");
+    s_lift_gains_lookup(1, LiftLoadEmpty, 270.0f, &g);
+    TEST_NEAR(g.kp, 0.46, 1e-6, "interpolated at 270 mm");
+    s_lift_gains_lookup(1, LiftLoadEmpty, -10.0f, &g);
+    TEST_NEAR(g.kp, 0.1, 1e-6, "clamped below");
+    s_lift_gains_lookup(1, LiftLoadEmpty, 320.0f, &g);
+    TEST_NEAR(g.kp, 0.5, 1e-6, "clamped above");
+
+    /* 断点必须递增 */
+    const float bad[LIFT_GAINS_POINTS] = { 0.0f, 200.0f, 200.0f };
+    TEST_CHECK(!s_lift_gains_set_points(bad), "non-increasing breakpoints accepted");
+    const float pts[LIFT_GAINS_POINTS] = { 0.0f, 100.0f, 300.0f };
+    TEST_CHECK(s_lift_gains_set_points(pts), "breakpoints rejected");
+    s_lift_gains_lookup(1, LiftLoadEmpty, 100.0f, &g);
+    TEST_NEAR(g.kp, 0.3, 1e-6, "moved breakpoint");
+
+    /* 开始定位时直接取查表值; 参考速度低于判定阈值时保持方向 */
+    s_lift_gains_set_load(LiftLoadEmpty);
+    TEST_NEAR(s_lift_gains_reset(1, 100.0f)->kp, 0.3, 1e-6, "reset takes the table value");
+    TEST_NEAR(s_lift_gains_update(0.5f, 100.0f, DT_S)->kp, 0.3, 1e-6, "direction kept below dir_speed");
+
+    /* 换向: 下行空载仍为基准 kp 0.2, 一个周期只走一小步, 0.6 s 后基本到位 */
+    float kp = s_lift_gains_update(-30.0f, 100.0f, DT_S)->kp;
+    TEST_CHECK(kp < 0.3f && kp > 0.29f, "first step after reversal kp %.4f", kp);
+    for(int i = 1; i < 60; ++i) kp = s_lift_gains_update(-30.0f, 100.0f, DT_S)->kp;
+    TEST_NEAR(kp, 0.2, 0.1 * 0.06, "kp 0.6 s after reversal");
+
+    /* 夹持负载: 过渡同样平滑 */
+    lift_gains_t held = { 0.4f, 0.05f, 0.06f };
+    TEST_CHECK(s_lift_gains_set(-1, LiftLoadHeld, 1, &held), "held set rejected");
+    s_lift_gains_set_load(LiftLoadHeld);
+    TEST_CHECK(s_lift_gains_load() == LiftLoadHeld, "load not set");
+    for(int i = 0; i < 200; ++i) kp = s_lift_gains_update(-30.0f, 100.0f, DT_S)->kp;
+    TEST_NEAR(kp, 0.4, 1e-3, "held kp settled");
+
+    /* 停用: 立即回到基准增益 */
+    s_lift_gains_disable();
+    TEST_CHECK(!s_lift_gains_enabled(), "still enabled");
+    TEST_NEAR(s_lift_gains_update(-30.0f, 100.0f, DT_S)->kp, base.kp, 1e-6, "base after disable");
+
+    return TEST_RESULT("test_lift_gains");
+}
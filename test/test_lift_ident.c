@@ -0,0 +1,210 @@
+/**
+ * @file    test_lift_ident.c
+ * @brief   升降台阶跃辨识: 已知一阶惯性 + 纯滞后对象应辨识出原参数
+ * @note    对象: v(s) / u(s) = K · e^(-L·s) / (τ·s + 1), 上下行 K 可不同, 指令每周期保持 (零阶保持),
+ *          内部 0.1 ms 积分. 试验参数同 a_board.c lift_ident_cfg (继电器幅值 1, 每方向 0.8 s).
+ *          拟合段从 run_s / 2 开始, 对象应使 run_s / 2 - L 为 τ 的数倍 (渐近线已建立).
+ *          无量化时 K 误差 2% 内, τ / L 误差 10 ms 内; 按 15.518 脉冲/mm 量化后 K 3% 内, τ / L 20 ms 内.
+ *          另检查 s_lift_smith_set_model 拒绝空指针与无效模型; 模型准确时 Smith 预估位置等于纯滞后之后的实际位置,
+ *          常值负载下扰动估计收敛到负载
+ */
+#include "test.h"
+#include "s_lift_ident.h"
+#include "s_lift_smith.h"
+
+#include <stdbool.h>
+
+// ! ========================= 变 量 声 明 ========================= ! //
+
+#define TICK_S              0.01
+#define SUB                 100
+#define PULSE_PER_MM        15.518
+#define HIST                64
+
+typedef struct {
+    double k_up, k_dn, tau, dead;
+} plant_t;
+
+// 同 a_board.c lift_ident_cfg
+static const lift_ident_cfg_t lift_ident_cfg = {
+    .amp = 1.0f,
+    .run_s = 0.8f,
+    .travel_mm = 30.0f,
+    .move_mm = 0.3f,
+    .still_s = 0.5f,
+};
+
+// 同 a_board.c lift_smith_cfg
+static const lift_smith_cfg_t lift_smith_cfg = {
+    .period_s = 0.01f,
+    .obs_tau_s = 0.5f,
+};
+
+static const plant_t* _p;
+static double _x, _v;
+static double _load;                // 输入端负载 (占空比)
+static double _t;                   // 对象时间
+static float _u_hist[HIST];         // 各周期的指令
+static int _tick;
+static bool _quant;
+
+// ! ========================= 私 有 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   对象复位到 pos_mm 静止
+ */
+static void plant_reset(const plant_t* p, double pos_mm, bool quant) {
+    _p = p;
+    _x = pos_mm;
+    _v = 0.0;
+    _t = 0.0;
+    _tick = 0;
+    _load = 0.0;
+    _quant = quant;
+    for(int i = 0; i < HIST; ++i) _u_hist[i] = 0.0f;
+}
+
+/**
+ * @brief   对象前进一个周期, 本周期指令 u 经纯滞后后生效
+ */
+static void plant_step(float u) {
+    _u_hist[_tick % HIST] = u;
+    for(int i = 0; i < SUB; ++i) {
+        double h = TICK_S / SUB;
+        double td = _t + 0.5 * h - _p->dead;
+        double a = 0.0;
+        if(td >= 0.0) {
+            int k = (int)(td / TICK_S);
+            if(k > _tick) k = _tick;
+            a = _u_hist[k % HIST];
+        }
+        double k = (a >= 0.0) ? _p->k_up : _p->k_dn;
+        _v += (k * (a + _load) - _v) * h / _p->tau;
+        _x += _v * h;
+        _t += h;
+    }
+    ++_tick;
+}
+
+/**
+ * @brief   测量位置 (可选编码器量化)
+ */
+static float plant_pos(void) {
+    return (float)(_quant ? floor(_x * PULSE_PER_MM) / PULSE_PER_MM : _x);
+}
+
+/**
+ * @brief   在对象上运行一次辨识
+ */
+static bool run_ident(const plant_t* p, bool quant, lift_ident_result_t* res) {
+    plant_reset(p, 100.0, quant);
+    s_lift_ident_init(&lift_ident_cfg);
+    s_lift_ident_start(plant_pos(), 1000.0f);
+
+    float u = 0.0f;
+    for(int t = 0; t < 1000 && s_lift_ident_status() == LiftIdentRunning; ++t) {
+        u = s_lift_ident_update(plant_pos(), (float)TICK_S);
+        plant_step(u);
+    }
+    return s_lift_ident_result(res);
+}
+
+static void check_dir(const char* name, const lift_fopdt_t* m, double k, double tau, double dead, bool quant) {
+    char what[64];
+    double k_tol = (quant ? 0.03 : 0.02) * k;
+    double t_tol = quant ? 0.02 : 0.01;
+    snprintf(what, sizeof(what), "%s K", name);
+    TEST_NEAR(m->k_mm_s, k, k_tol, what);
+    snprintf(what, sizeof(what), "%s tau", name);
+    TEST_NEAR(m->tau_s, tau, t_tol, what);
+    snprintf(what, sizeof(what), "%s dead", name);
+    TEST_NEAR(m->dead_s, dead, t_tol, what);
+}
+
+static void test_plant(const plant_t* p, bool quant) {
+    lift_ident_result_t r;
+    char name[64];
+    snprintf(name, sizeof(name), "K %.0f/%.0f tau %.2f L %.2f%s", p->k_up, p->k_dn, p->tau, p->dead, quant ? " quant" : "");
+
+    bool ok = run_ident(p, quant, &r);
+    TEST_CHECK(ok, "%s: ident failed, err %d", name, (int)s_lift_ident_error());
+    if(!ok) return;
+
+    printf("%-36s: up K %.2f tau %.3f L %.3f, down K %.2f tau %.3f L %.3f\n", name,
+        r.dir[0].k_mm_s, r.dir[0].tau_s, r.dir[0].dead_s, r.dir[1].k_mm_s, r.dir[1].tau_s, r.dir[1].dead_s);
+    check_dir(name, &r.dir[0], p->k_up, p->tau, p->dead, quant);
+    check_dir(name, &r.dir[1], p->k_dn, p->tau, p->dead, quant);
+    check_dir(name, &r.model, 0.5 * (p->k_up + p->k_dn), p->tau, p->dead, quant);
+}
+
+static void test_smith_model(void) {
+    lift_fopdt_t m = {.k_mm_s = 40.0f, .tau_s = 0.1f, .dead_s = 0.08f};
+    TEST_CHECK(!s_lift_smith_set_model(&m), "smith: model accepted before init");
+    s_lift_smith_init(&lift_smith_cfg);
+    TEST_CHECK(!s_lift_smith_set_model(0), "smith: null model accepted");
+    TEST_CHECK(s_lift_smith_set_model(&m), "smith: valid model rejected");
+    m.k_mm_s = 0.0f;
+    TEST_CHECK(!s_lift_smith_set_model(&m), "smith: zero gain accepted");
+}
+
+/**
+ * @brief   模型准确时的 Smith 预估: 预估位置与 L 之后的实际位置比较; 常值负载下的扰动估计
+ */
+static void test_smith_predict(void) {
+    static const plant_t p = {40.0, 40.0, 0.10, 0.08};
+    const lift_fopdt_t m = {.k_mm_s = 40.0f, .tau_s = 0.1f, .dead_s = 0.08f};
+    const int n = 8;
+    float pred[300];
+    double pos[300 + 8];
+
+    plant_reset(&p, 100.0, false);
+    s_lift_smith_init(&lift_smith_cfg);
+    s_lift_smith_set_model(&m);
+    s_lift_smith_enable(true);
+    s_lift_smith_reset(0.0f);
+
+    /* 0.5 占空比 0.6 s, 反向 0.3 s, 然后停止 */
+    float u_prev = 0.0f;
+    for(int t = 0; t < 300 + n; ++t) {
+        pos[t] = _x;
+        if(t < 300) pred[t] = s_lift_smith_update((float)_x, (float)_v, u_prev, (float)TICK_S);
+        float u = (t < 60) ? 0.5f : (t < 90) ? -0.5f : 0.0f;
+        plant_step(u);
+        u_prev = u;
+    }
+    double max_err = 0.0;
+    for(int t = 0; t < 300; ++t) {
+        double e = fabs(pred[t] - pos[t + n]);
+        if(e > max_err) max_err = e;
+    }
+    printf("smith: max |prediction - position L later| %.3f mm\n", max_err);
+    TEST_CHECK(max_err < 0.1, "smith prediction error %.3f mm", max_err);
+
+    /* 常值负载 -0.15: 保持 0.4 占空比 4 s 后扰动估计应接近负载 */
+    plant_reset(&p, 100.0, false);
+    _load = -0.15;
+    s_lift_smith_reset(0.0f);
+    for(int t = 0; t < 400; ++t) {
+        s_lift_smith_update((float)_x, (float)_v, t ? 0.4f : 0.0f, (float)TICK_S);
+        plant_step(0.4f);
+    }
+    TEST_NEAR(s_lift_smith_disturbance(), -0.15, 0.01, "smith disturbance estimate");
+}
+
+// ! ========================= 接 口 函 数 实 现 ========================= ! //
+
+int main(void) {
+    static const plant_t plants[] = {
+        {40.0, 40.0, 0.10, 0.08},
+        {40.0, 46.0, 0.10, 0.08},
+        {40.0, 46.0, 0.05, 0.03},
+        {30.0, 35.0, 0.08, 0.12},
+    };
+    for(unsigned i = 0; i < sizeof(plants) / sizeof(plants[0]); ++i) {
+        test_plant(&plants[i], false);
+        test_plant(&plants[i], true);
+    }
+    test_smith_model();
+    test_smith_predict();
+    return TEST_RESULT("test_lift_ident");
+}
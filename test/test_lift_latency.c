@@ -0,0 +1,79 @@
+/**
+ * @file    test_lift_latency.c
+ * @brief   驱动延迟测量: 起动到第一个编码器边沿, 停车到最后一个边沿
+ * @note    DWT 周期计数与编码器计数由测试模拟, 1 ms 轮询一次
+ */
+#include "test.h"
+#include "s_lift_latency.h"
+
+// ! ========================= 变 量 声 明 ========================= ! //
+
+#define CYCLES_PER_MS   72000u
+
+static uint32_t _now_ms;
+static int64_t _pulses;
+
+// ! ========================= 私 有 函 数 实 现 ========================= ! //
+
+static uint32_t get_cycles(void) {
+    return _now_ms * CYCLES_PER_MS;
+}
+
+static int64_t read_pulses(void) {
+    return _pulses;
+}
+
+/**
+ * @brief   运行 ms 毫秒, 每毫秒位移 step 脉冲并轮询一次
+ */
+static void run(uint32_t ms, int step) {
+    for(uint32_t i = 0; i < ms; ++i) {
+        ++_now_ms;
+        _pulses += step;
+        s_lift_latency_poll();
+    }
+}
+
+// ! ========================= 接 口 函 数 实 现 ========================= ! //
+
+int main(void) {
+    s_lift_latency_init(get_cycles, read_pulses, CYCLES_PER_MS);
+    lift_latency_stat_t st;
+
+    /* 上行: 24 ms 后开始运动, 停车后 60 ms 才静止 */
+    s_lift_latency_command(1);
+    run(23, 0);
+    run(477, 2);
+    s_lift_latency_command(0);
+    run(60, 1);
+    run(100, 0);
+
+    s_lift_latency_get(LiftLatencyStartUp, &st);
+    TEST_CHECK(st.count == 1, "start up: %u samples", (unsigned)st.count);
+    TEST_NEAR(st.last_ms, 24.0, 1e-3, "start up latency");
+    TEST_NEAR(s_lift_latency_lead_s(1), 0.024, 1e-6, "lead up");
+    s_lift_latency_get(LiftLatencyStopUp, &st);
+    TEST_CHECK(st.count == 1, "stop up: %u samples", (unsigned)st.count);
+    TEST_NEAR(st.last_ms, 60.0, 1e-3, "stop up time");
+
+    /* 下行无边沿: 超时后放弃, 不记样本 */
+    s_lift_latency_command(-1);
+    run(LIFT_LATENCY_TIMEOUT_MS + 50, 0);
+    s_lift_latency_get(LiftLatencyStartDown, &st);
+    TEST_CHECK(st.count == 0, "start down without motion recorded %u samples", (unsigned)st.count);
+    TEST_NEAR(s_lift_latency_lead_s(-1), 0.0, 1e-9, "lead down without samples");
+
+    /* 直接换向不测量 */
+    s_lift_latency_command(1);
+    run(10, 0);
+    s_lift_latency_command(-1);
+    run(10, -1);
+    s_lift_latency_get(LiftLatencyStartDown, &st);
+    TEST_CHECK(st.count == 0, "reversal measured as start");
+
+    s_lift_latency_reset();
+    s_lift_latency_get(LiftLatencyStartUp, &st);
+    TEST_CHECK(st.count == 0 && s_lift_latency_lead_s(1) == 0.0f, "reset kept samples");
+
+    return TEST_RESULT("test_lift_latency");
+}
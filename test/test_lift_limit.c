@@ -0,0 +1,77 @@
+/**
+ * @file    test_lift_limit.c
+ * @brief   软限位: 目标钳位, 减速区内的允许驱动, 修改限位后航点钳位
+ * @note    参数同 a_board.c lift_limit_cfg
+ */
+#include "test.h"
+#include "s_lift_limit.h"
+#include "s_lift_queue.h"
+
+#include <math.h>
+
+// ! ========================= 变 量 声 明 ========================= ! //
+
+static const lift_limit_cfg_t lift_limit_cfg = {
+    .min_mm = 2.0f,
+    .max_mm = 300.0f,
+    .decel_mm_s2 = 50.0f,
+    .creep_mm_s = 3.0f,
+    .full_speed_mm_s = 40.0f,
+};
+
+// ! ========================= 接 口 函 数 实 现 ========================= ! //
+
+int main(void) {
+    /* 未初始化时不限制 */
+    TEST_NEAR(s_lift_limit_clamp(500.0f), 500.0, 1e-6, "clamp before init");
+    TEST_NEAR(s_lift_limit_drive(300.0f, 40.0f, 1), 1.0, 1e-6, "drive before init");
+
+    s_lift_limit_init(&lift_limit_cfg);
+    TEST_NEAR(s_lift_limit_clamp(-5.0f), 2.0, 1e-6, "clamp below");
+    TEST_NEAR(s_lift_limit_clamp(150.0f), 150.0, 1e-6, "clamp inside");
+    TEST_NEAR(s_lift_limit_clamp(310.0f), 300.0, 1e-6, "clamp above");
+
+    /* 远离限位: 满驱动 */
+    TEST_NEAR(s_lift_limit_drive(100.0f, 40.0f, 1), 1.0, 1e-6, "far from max");
+
+    /* 距上限 4 mm: v_allow = sqrt(9 + 400) ≈ 20.2 mm/s, 低速时按 v_allow / full 限幅, 超速时断开 */
+    float v_allow = sqrtf(9.0f + 2.0f * 50.0f * 4.0f);
+    TEST_NEAR(s_lift_limit_drive(296.0f, 10.0f, 1), v_allow / 40.0f, 1e-5, "slow-down zone scale");
+    TEST_NEAR(s_lift_limit_drive(296.0f, v_allow + 1.0f, 1), 0.0, 1e-6, "over speed in slow-down zone");
+
+    /* 减速区长度随速度: 以全速接近时 (40² - 3²) / 100 ≈ 15.9 mm 处开始断开, 10 mm/s 时只在 1 mm 内 */
+    TEST_CHECK(s_lift_limit_drive(300.0f - 16.5f, 40.0f, 1) > 0.0f, "full speed cut too early");
+    TEST_CHECK(s_lift_limit_drive(300.0f - 15.5f, 40.0f, 1) == 0.0f, "full speed not cut");
+    TEST_CHECK(s_lift_limit_drive(300.0f - 1.5f, 10.0f, 1) > 0.0f, "10 mm/s cut too early");
+
+    /* 限位处与限位外: 朝限位方向断开, 背离方向不受限制 */
+    TEST_NEAR(s_lift_limit_drive(300.0f, 0.0f, 1), 0.0, 1e-6, "at max");
+    TEST_NEAR(s_lift_limit_drive(2.0f, 0.0f, -1), 0.0, 1e-6, "at min");
+    TEST_NEAR(s_lift_limit_drive(300.0f, -40.0f, -1), 1.0, 1e-6, "leaving max");
+    TEST_NEAR(s_lift_limit_drive(1.0f, 0.0f, 1), 1.0, 1e-6, "leaving min");
+
+    /* 无效范围不生效 */
+    TEST_CHECK(!s_lift_limit_set(100.0f, 100.0f), "accepted min == max");
+    TEST_CHECK(!s_lift_limit_set(120.0f, 100.0f), "accepted min > max");
+    float lo, hi;
+    s_lift_limit_get(&lo, &hi);
+    TEST_CHECK(lo == 2.0f && hi == 300.0f, "invalid set changed limits to %.1f / %.1f", lo, hi);
+
+    /* 修改限位后未执行的航点钳位到新范围 */
+    TEST_CHECK(s_lift_limit_set(20.0f, 200.0f), "valid limits rejected");
+    TEST_NEAR(s_lift_limit_clamp(250.0f), 200.0, 1e-6, "clamp to new max");
+    s_lift_queue_push(10.0f, 0);
+    s_lift_queue_push(150.0f, 0);
+    s_lift_queue_push(250.0f, 1000);
+    TEST_CHECK(s_lift_queue_clamp(20.0f, 200.0f) == 2, "queue clamp count");
+    lift_wp_t wp;
+    s_lift_queue_peek(0, &wp);
+    TEST_NEAR(wp.pos_mm, 20.0, 1e-6, "waypoint 0");
+    s_lift_queue_peek(1, &wp);
+    TEST_NEAR(wp.pos_mm, 150.0, 1e-6, "waypoint 1");
+    s_lift_queue_peek(2, &wp);
+    TEST_NEAR(wp.pos_mm, 200.0, 1e-6, "waypoint 2");
+    TEST_CHECK(wp.dwell_ms == 1000, "waypoint 2 dwell %u", (unsigned)wp.dwell_ms);
+
+    return TEST_RESULT("test_lift_limit");
+}
@@ -0,0 +1,83 @@
+/**
+ * @file    test_lift_monitor.c
+ * @brief   升降台运动监视: 堵转 / 反向运动 / 停止时运动; 堵转只在应运动时判断
+ * @note    参数同 a_board.c lift_monitor_cfg (15.518 脉冲/mm)
+ */
+#include "test.h"
+#include "s_lift_monitor.h"
+
+// ! ========================= 变 量 声 明 ========================= ! //
+
+static const lift_monitor_cfg_t lift_monitor_cfg = {
+    .window_ticks = 20,
+    .start_grace_ticks = 30,
+    .stop_grace_ticks = 50,
+    .stall_pulses = 15,
+    .wrong_dir_pulses = 46,
+    .creep_pulses = 46,
+};
+
+// ! ========================= 私 有 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   以固定指令运行 n 个周期, 每周期位移 step 脉冲
+ * @retval  int 首次报故障的周期序号 (从 1 开始), 未报故障为 0
+ */
+static int run(int8_t dir, bool driven, int64_t* pulses, int32_t step, int n) {
+    for(int i = 0; i < n; ++i) {
+        *pulses += step;
+        if(s_lift_monitor_update(dir, driven, *pulses) != LiftFaultNone) return i + 1;
+    }
+    return 0;
+}
+
+// ! ========================= 接 口 函 数 实 现 ========================= ! //
+
+int main(void) {
+    int64_t pulses = 0;
+    s_lift_monitor_init(&lift_monitor_cfg);
+
+    /* 驱动而不动: 宽限期 + 满窗口时报堵转 */
+    int t = run(1, true, &pulses, 0, 100);
+    TEST_CHECK(t == 51 && s_lift_monitor_fault() == LiftFaultStall, "stall at start: tick %d, fault %d", t, (int)s_lift_monitor_fault());
+    s_lift_monitor_reset();
+
+    /* 运动 100 个周期后卡死: 一个窗口内报堵转 */
+    run(0, false, &pulses, 0, 60);
+    TEST_CHECK(run(1, true, &pulses, 8, 100) == 0, "normal move tripped");
+    t = run(1, true, &pulses, 0, 100);
+    TEST_CHECK(t > 0 && t <= 20 && s_lift_monitor_fault() == LiftFaultStall, "stall during move: tick %d, fault %d", t, (int)s_lift_monitor_fault());
+    s_lift_monitor_reset();
+
+    /* 上行指令下坠: 窗口填满前即报反向运动 */
+    run(0, false, &pulses, 0, 60);
+    t = run(1, true, &pulses, -5, 60);
+    TEST_CHECK(t > 30 && t <= 50 && s_lift_monitor_fault() == LiftFaultWrongDir, "wrong direction: tick %d, fault %d", t, (int)s_lift_monitor_fault());
+    s_lift_monitor_reset();
+
+    /* 停止指令下运动 */
+    TEST_CHECK(run(0, false, &pulses, 0, 100) == 0, "still platform tripped");
+    t = run(0, false, &pulses, 3, 100);
+    TEST_CHECK(t > 0 && s_lift_monitor_fault() == LiftFaultCreep, "creep: tick %d, fault %d", t, (int)s_lift_monitor_fault());
+    s_lift_monitor_reset();
+
+    /* 小占空比保持 (不应运动): 驱动不为 0 但静止, 不报堵转, 也不按停止判蠕动 */
+    TEST_CHECK(run(1, false, &pulses, 0, 500) == 0, "hold with small duty tripped");
+    TEST_CHECK(run(1, false, &pulses, 1, 300) == 0, "slow correction tripped");
+
+    /* 同一方向转为应运动而不动: 宽限期 + 窗口内报堵转 */
+    t = run(1, true, &pulses, 0, 51);
+    TEST_CHECK(t > 0 && s_lift_monitor_fault() == LiftFaultStall, "stall after hold: tick %d, fault %d", t, (int)s_lift_monitor_fault());
+    s_lift_monitor_reset();
+
+    /* 不应运动时仍检查反向 */
+    run(0, false, &pulses, 0, 60);
+    t = run(1, false, &pulses, -5, 60);
+    TEST_CHECK(t > 0 && s_lift_monitor_fault() == LiftFaultWrongDir, "wrong direction while holding: tick %d, fault %d", t, (int)s_lift_monitor_fault());
+    s_lift_monitor_reset();
+
+    /* 下行正常运动 */
+    TEST_CHECK(run(-1, true, &pulses, -8, 300) == 0, "normal move down tripped");
+
+    return TEST_RESULT("test_lift_monitor");
+}
@@ -0,0 +1,78 @@
+/**
+ * @file    test_lift_profile.c
+ * @brief   升降台轨迹规划: 各种行程无超调到达终点, 中途改目标时速度连续
+ * @note    约束同 a_board.c lift_profile_cfg (v 30 mm/s, a 100 mm/s^2, j 1000 mm/s^3, 10 ms)
+ */
+#include "test.h"
+#include "s_lift_profile.h"
+
+// ! ========================= 变 量 声 明 ========================= ! //
+
+static const lift_profile_cfg_t lift_profile_cfg = {
+    .v_max = 30.0f,
+    .a_max = 100.0f,
+    .j_max = 1000.0f,
+    .tick_s = 0.01f,
+};
+
+// ! ========================= 私 有 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   从 100 mm 静止出发走 dist 行程, 检查超调、速度/加速度约束与终点
+ */
+static void check_move(float dist) {
+    const float a_tick = lift_profile_cfg.a_max * lift_profile_cfg.tick_s;
+    float target = 100.0f + dist;
+    float sign = dist > 0.0f ? 1.0f : -1.0f;
+
+    s_lift_profile_reset(100.0f, 0.0f);
+    s_lift_profile_set_target(target);
+
+    float over = 0.0f, max_dv = 0.0f, max_v = 0.0f, prev_v = 0.0f;
+    int t = 0;
+    for(; t < 3000 && !s_lift_profile_update(); ++t) {
+        float v = s_lift_profile_vel();
+        float o = (s_lift_profile_pos() - target) * sign;
+        if(o > over) over = o;
+        if(fabsf(v - prev_v) > max_dv) max_dv = fabsf(v - prev_v);
+        if(fabsf(v) > max_v) max_v = fabsf(v);
+        prev_v = v;
+    }
+
+    TEST_CHECK(t < 3000, "move %.1f mm: profile not done", dist);
+    TEST_NEAR(s_lift_profile_pos(), target, 1e-3, "move end position");
+    TEST_CHECK(over < 0.15f, "move %.1f mm: reference overshoot %.3f mm", dist, over);
+    TEST_CHECK(max_v <= lift_profile_cfg.v_max + 1e-3f, "move %.1f mm: speed %.2f mm/s", dist, max_v);
+    TEST_CHECK(max_dv <= a_tick + 1e-3f, "move %.1f mm: velocity step %.3f mm/s per tick", dist, max_dv);
+}
+
+// ! ========================= 接 口 函 数 实 现 ========================= ! //
+
+int main(void) {
+    s_lift_profile_init(&lift_profile_cfg);
+
+    static const float dists[] = {0.5f, 3.0f, -20.0f, 100.0f, 250.0f};
+    for(unsigned i = 0; i < sizeof(dists) / sizeof(dists[0]); ++i) {
+        check_move(dists[i]);
+    }
+
+    /* 100 -> 200 mm 运动中 1.5 s 改为 40 mm: 速度连续, 反向后到达新目标 */
+    const float a_tick = lift_profile_cfg.a_max * lift_profile_cfg.tick_s;
+    s_lift_profile_reset(100.0f, 0.0f);
+    s_lift_profile_set_target(200.0f);
+    float prev_v = 0.0f, max_dv = 0.0f;
+    int t = 0;
+    for(; t < 3000; ++t) {
+        if(t == 150) s_lift_profile_set_target(40.0f);
+        bool done = s_lift_profile_update();
+        float v = s_lift_profile_vel();
+        if(fabsf(v - prev_v) > max_dv) max_dv = fabsf(v - prev_v);
+        prev_v = v;
+        if(done && t > 150) break;
+    }
+    TEST_CHECK(t < 3000, "retarget: profile not done");
+    TEST_NEAR(s_lift_profile_pos(), 40.0f, 1e-3, "retarget end position");
+    TEST_CHECK(max_dv <= a_tick + 1e-3f, "retarget: velocity step %.3f mm/s per tick", max_dv);
+
+    return TEST_RESULT("test_lift_profile");
+}
@@ -0,0 +1,160 @@
+/**
+ * @file    test_pid.c
+ * @brief   增量式 PID (PID_MODE_INCREMENTAL) 与无扰切换, 二自由度 PID (PID_MODE_2DOF) 设定值加权
+ * @note    - track 以当前输出初始化后, 下一拍输出只差一拍积分增量 (位置式与增量式)
+ *          - 误差不变时修改增益: 增量式输出不跳变, 位置式跳变 Δkp·e
+ *          - 输出饱和后误差回落: 增量式输出为 kp·e (比例项未被限幅截去), 饱和期间不积分
+ *          二自由度: 实际值保持 0, 目标从 0 阶跃到 R, 看阶跃当拍的输出 (位置式与增量式都应相同):
+ *          - 只有比例项时输出为 b·kp·R (b 缩放比例冲击, b = 0 无冲击)
+ *          - 只有微分项时输出为 c·kd·R / dt (c = 0 即微分先行, 无微分冲击)
+ *          - 配置表 setpoint_weight_b/c 与 set_weights 效果相同
+ *          - 目标不变、实际值阶跃时, 比例与微分的响应与 b / c 无关
+ */
+#include "test.h"
+#include "s_pid.h"
+
+#include <stdbool.h>
+
+// ! ========================= 变 量 声 明 ========================= ! //
+
+#define DT_S        0.01f
+#define KP          0.2f
+#define KI          0.05f
+#define KD          0.06f
+
+#define STEP        10.0f
+#define KP_2DOF     2.0f
+#define KD_2DOF     0.5f
+
+// ! ========================= 私 有 函 数 实 现 ========================= ! //
+
+static PID make_pid(uint8_t mode, uint8_t features) {
+    pid_cfg_t cfg = {
+        .mode = mode,
+        .features = features,
+        .kp = KP,
+        .ki = KI,
+        .kd = KD,
+        .max_out = 1.0f,
+    };
+    PID pid = pid_create();
+    pid.init_cfg(&pid, &cfg);
+    return pid;
+}
+
+/**
+ * @brief   track 后第一拍输出与接续的输出之差
+ */
+static void test_track(uint8_t mode) {
+    PID pid = make_pid(mode, PID_FEAT_OUTPUT_LIMIT);
+    pid.track(&pid, 0.4f, 102.0f, 100.0f);
+    float out = pid.calculate(&pid, 102.0f, 100.0f, DT_S);
+    TEST_NEAR(out, 0.4f, KI * 2.0f * DT_S + 1e-5f, (mode & PID_MODE_INCREMENTAL) ? "inc track" : "pos track");
+}
+
+/**
+ * @brief   误差不变时改增益, 返回输出跳变量
+ */
+static float gain_bump(uint8_t mode) {
+    PID pid = make_pid(mode, PID_FEAT_NONE);
+    float out = 0.0f;
+    for(int i = 0; i < 20; ++i) out = pid.calculate(&pid, 3.0f, 0.0f, DT_S);
+    pid.set_gains(&pid, 2.0f * KP, KI, KD);
+    return pid.calculate(&pid, 3.0f, 0.0f, DT_S) - out;
+}
+
+/**
+ * @brief   在 0 处运行几拍建立历史, 然后目标阶跃, 返回阶跃当拍输出
+ */
+static float step_kick(uint8_t mode, float kp, float kd, float b, float c, bool by_cfg) {
+    pid_cfg_t cfg = {
+        .mode = mode,
+        .features = PID_FEAT_NONE,
+        .kp = kp,
+        .kd = kd,
+        .setpoint_weight_b = b,
+        .setpoint_weight_c = c,
+    };
+    PID pid = pid_create();
+    pid.init_cfg(&pid, &cfg);
+    if(!by_cfg) {
+        pid.set_weights(&pid, 0.3f, 0.7f);  // 任意值, 下面覆盖
+        pid.set_weights(&pid, b, c);
+    }
+    for(int i = 0; i < 5; ++i) pid.calculate(&pid, 0.0f, 0.0f, DT_S);
+    return pid.calculate(&pid, STEP, 0.0f, DT_S);
+}
+
+/**
+ * @brief   目标保持 0, 实际值阶跃, 返回阶跃当拍输出
+ */
+static float meas_kick(uint8_t mode, float kp, float kd, float b, float c) {
+    pid_cfg_t cfg = {
+        .mode = mode,
+        .features = PID_FEAT_NONE,
+        .kp = kp,
+        .kd = kd,
+        .setpoint_weight_b = b,
+        .setpoint_weight_c = c,
+    };
+    PID pid = pid_create();
+    pid.init_cfg(&pid, &cfg);
+    for(int i = 0; i < 5; ++i) pid.calculate(&pid, 0.0f, 0.0f, DT_S);
+    return pid.calculate(&pid, 0.0f, STEP, DT_S);
+}
+
+static void test_mode(uint8_t base, const char* name) {
+    static const float w[] = {0.0f, 0.5f, 1.0f};
+    uint8_t mode = (uint8_t)(base | PID_MODE_2DOF);
+    char what[64];
+
+    for(unsigned i = 0; i < sizeof(w) / sizeof(w[0]); ++i) {
+        for(int by_cfg = 0; by_cfg < 2; ++by_cfg) {
+            snprintf(what, sizeof(what), "%s P kick b %.1f%s", name, w[i], by_cfg ? " (cfg)" : "");
+            TEST_NEAR(step_kick(mode, KP_2DOF, 0.0f, w[i], 0.0f, by_cfg), w[i] * KP_2DOF * STEP, 1e-4, what);
+
+            snprintf(what, sizeof(what), "%s D kick c %.1f%s", name, w[i], by_cfg ? " (cfg)" : "");
+            TEST_NEAR(step_kick(mode, 0.0f, KD_2DOF, 1.0f, w[i], by_cfg), w[i] * KD_2DOF * STEP / DT_S, 1e-2, what);
+        }
+
+        snprintf(what, sizeof(what), "%s measurement P b %.1f", name, w[i]);
+        TEST_NEAR(meas_kick(mode, KP_2DOF, 0.0f, w[i], 0.0f), -KP_2DOF * STEP, 1e-4, what);
+        snprintf(what, sizeof(what), "%s measurement D c %.1f", name, w[i]);
+        TEST_NEAR(meas_kick(mode, 0.0f, KD_2DOF, 1.0f, w[i]), -KD_2DOF * STEP / DT_S, 1e-2, what);
+    }
+
+    /* c = 0 与测量微分一致: 目标阶跃时完整 PD 只剩 b 缩放的比例冲击 */
+    snprintf(what, sizeof(what), "%s PD kick b 0.5 c 0", name);
+    TEST_NEAR(step_kick(mode, KP_2DOF, KD_2DOF, 0.5f, 0.0f, true), 0.5f * KP_2DOF * STEP, 1e-4, what);
+
+    printf("%-11s: P kick b 1 / 0.5 / 0 = %.2f / %.2f / %.2f, D kick c 1 / 0 = %.1f / %.1f\n", name,
+        step_kick(mode, KP_2DOF, 0.0f, 1.0f, 0.0f, true), step_kick(mode, KP_2DOF, 0.0f, 0.5f, 0.0f, true),
+        step_kick(mode, KP_2DOF, 0.0f, 0.0f, 0.0f, true),
+        step_kick(mode, 0.0f, KD_2DOF, 1.0f, 1.0f, true), step_kick(mode, 0.0f, KD_2DOF, 1.0f, 0.0f, true));
+}
+
+// ! ========================= 接 口 函 数 实 现 ========================= ! //
+
+int main(void) {
+    test_track(PID_MODE_PID);
+    test_track(PID_MODE_PID | PID_MODE_INCREMENTAL);
+
+    float bump_inc = gain_bump(PID_MODE_PID | PID_MODE_INCREMENTAL);
+    float bump_pos = gain_bump(PID_MODE_PID);
+    TEST_NEAR(bump_inc, KI * 3.0f * DT_S, 1e-5, "inc gain change bump");
+    TEST_NEAR(bump_pos, KP * 3.0f + KI * 3.0f * DT_S, 1e-4, "pos gain change bump");
+
+    /* 饱和: 误差 20 mm (kp·e = 4) 保持 1 s, 回落到 4 mm 时输出应为 kp·4, 回到 0 时输出约为 0 */
+    PID pid = make_pid(PID_MODE_PI | PID_MODE_INCREMENTAL, PID_FEAT_OUTPUT_LIMIT);
+    float out = 0.0f;
+    for(int i = 0; i < 100; ++i) out = pid.calculate(&pid, 20.0f, 0.0f, DT_S);
+    TEST_NEAR(out, 1.0f, 1e-6, "saturated output");
+    out = pid.calculate(&pid, 4.0f, 0.0f, DT_S);
+    TEST_NEAR(out, KP * 4.0f, 0.02, "output after the error falls inside the limit");
+    out = pid.calculate(&pid, 0.0f, 0.0f, DT_S);
+    TEST_NEAR(out, 0.0f, 0.02, "output at zero error (integral wound up)");
+
+    test_mode(PID_MODE_PD, "positional");
+    test_mode(PID_MODE_PD | PID_MODE_INCREMENTAL, "incremental");
+    return TEST_RESULT("test_pid");
+}
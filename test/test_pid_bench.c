@@ -0,0 +1,157 @@
+/**
+ * @file    test_pid_bench.c
+ * @brief   PID 实现一致性: Q16.16 定点 / 特化核 / PIDBank 与浮点 PID 对比
+ * @note    直接运行 s_pid_bench 的对比 ($PID_BENCH / $PID_BENCH_BANK 同一代码), 周期计数为主机值, 只打印不检查:
+ *          - 定点与浮点各驱动一个仿真升降台 (40 mm/s, τ 0.1 s), 50 mm 阶跃 300 周期, 位置偏差应很小;
+ *            死区 / 积分分离是阈值判断, 量化误差可使某一周期落在阈值另一侧 (输出差一次跳变),
+ *            带这两项的配置位置偏差放宽到 0.1 mm, 其余 0.03 mm
+ *          - PID_DEFINE 特化核与 PIDBank 的计算顺序与 calculate 相同, 输出应完全一致 (全部 256 种特性组合)
+ *          - 二自由度与一自由度增益相同, 扰动前调节到位时扰动响应一致, 设定值响应的超调与限幅时间不增加
+ *          - 定点运算饱和到 int32 范围, 不溢出翻转
+ */
+#include "test.h"
+#include "s_pid.h"
+#include "s_pid_q16.h"
+#include "s_pid_bank.h"
+#include "s_pid_bench.h"
+#include "s_bench.h"
+
+// ! ========================= 变 量 声 明 ========================= ! //
+
+static const pid_bench_plant_t _plant = {
+    .v_max = 40.0f,
+    .tau_s = 0.1f,
+};
+
+// 同 a_board.c lift_pid_cfg
+static const pid_cfg_t _lift_cfg = {
+    .mode = PID_MODE_PID,
+    .features = PID_FEAT_OUTPUT_LIMIT | PID_FEAT_ANTI_WINDUP | PID_FEAT_INTEGRAL_SEP
+        | PID_FEAT_DEADBAND | PID_FEAT_DIFF_FILTER | PID_FEAT_FEEDFORWARD,
+    .kp = 0.2f,
+    .ki = 0.05f,
+    .kd = 0.06f,
+    .max_out = 1.0f,
+    .integral_separation = 5.0f,
+    .dead_band = 0.5f,
+    .diff_filter_alpha = 0.3f,
+    .output_max_rate = 0.0f,
+};
+
+static uint32_t _cycles = 0;
+
+// ! ========================= 私 有 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   主机上的周期计数 (每次读取加 1, 只保证 s_bench 可运行)
+ */
+static uint32_t host_cycles(void) {
+    return _cycles++;
+}
+
+/**
+ * @brief   定点与浮点闭环对比
+ */
+static void test_q16(const char* name, const pid_cfg_t* cfg, float dpos_max) {
+    pid_bench_result_t r;
+    s_pid_bench_init(cfg, &_plant, 0.01f);
+    s_pid_bench_run(PID_BENCH_STEP_MM, PID_BENCH_STEPS, &r);
+    printf("q16 %-5s: max du %.5f, max dpos %.4f mm, final error float %+.4f / q16 %+.4f mm\n",
+        name, r.max_du, r.max_dpos_mm, r.err_float_mm, r.err_q16_mm);
+    TEST_CHECK(r.max_dpos_mm < dpos_max, "q16 %s: position diverges by %.4f mm", name, r.max_dpos_mm);
+    TEST_NEAR(r.err_q16_mm, r.err_float_mm, dpos_max, name);
+}
+
+/**
+ * @brief   定点饱和: 误差与增益的乘积超出 int32 时输出停在极值
+ */
+static void test_q16_saturation(void) {
+    pid_cfg_t cfg = {
+        .mode = PID_MODE_P,
+        .features = PID_FEAT_NONE,
+        .kp = 20000.0f,
+    };
+    PIDQ16 pid = pid_q16_create();
+    pid.init_cfg(&pid, &cfg, 0.01f);
+    q16_t big = q16_from_float(30000.0f);
+    TEST_CHECK(pid.calculate(&pid, big, -big) == Q16_MAX, "q16 positive saturation");
+    TEST_CHECK(pid.calculate(&pid, -big, big) == Q16_MIN, "q16 negative saturation");
+}
+
+// ! ========================= 接 口 函 数 实 现 ========================= ! //
+
+int main(void) {
+    s_bench_init(host_cycles);
+
+    pid_cfg_t cfg = _lift_cfg;
+    test_q16("lift", &cfg, 0.1f);
+
+    cfg.mode = PID_MODE_PID;
+    cfg.features = PID_FEAT_ALL;
+    cfg.output_max_rate = 20.0f;
+    test_q16("all", &cfg, 0.1f);
+
+    cfg = _lift_cfg;
+    cfg.mode = PID_MODE_P;
+    cfg.features = PID_FEAT_OUTPUT_LIMIT;
+    test_q16("p", &cfg, 0.03f);
+
+    cfg.mode = PID_MODE_PI;
+    cfg.features = PID_FEAT_OUTPUT_LIMIT | PID_FEAT_ANTI_WINDUP;
+    test_q16("pi", &cfg, 0.03f);
+
+    test_q16_saturation();
+
+    /* 特化核 */
+    s_pid_bench_init(&_lift_cfg, &_plant, 0.01f);
+    for(int k = 0; k < PidKernelCount; ++k) {
+        pid_kernel_result_t r;
+        s_pid_bench_kernel((PidKernel_e)k, PID_BENCH_STEP_MM, PID_BENCH_STEPS, &r);
+        TEST_CHECK(r.max_du == 0.0f, "kernel %d: output differs by %g", k, r.max_du);
+    }
+
+    /* PIDBank: 每种特性组合, 1 / 4 / 8 通道 */
+    int bank_diff = 0;
+    for(unsigned mask = 0; mask <= PID_FEAT_ALL; ++mask) {
+        cfg = _lift_cfg;
+        cfg.features = (uint8_t)mask;
+        cfg.output_max_rate = 20.0f;
+        s_pid_bench_init(&cfg, &_plant, 0.01f);
+        for(uint8_t n = 1; n <= PID_BANK_MAX; n = (uint8_t)(n < 4 ? 4 : n * 2)) {
+            pid_bank_result_t r;
+            s_pid_bench_bank(n, PID_BENCH_STEP_MM, PID_BENCH_STEPS, &r);
+            if(r.max_du != 0.0f) {
+                if(bank_diff++ < 5) printf("bank features 0x%02X, n %u: output differs by %g\n", mask, n, r.max_du);
+            }
+        }
+    }
+    TEST_CHECK(bank_diff == 0, "PIDBank differs from PID in %d cases", bank_diff);
+
+    /* 二自由度: 线性 PID 在扰动前调节到位时增益相同, 扰动响应一致, b < 1 只减小设定值阶跃的比例冲击 */
+    cfg = _lift_cfg;
+    cfg.features = PID_FEAT_OUTPUT_LIMIT | PID_FEAT_ANTI_WINDUP;
+    cfg.ki = 0.2f;
+    cfg.kd = 0.02f;
+    s_pid_bench_init(&cfg, &_plant, 0.01f);
+    pid_2dof_result_t d;
+    s_pid_bench_2dof(PID_BENCH_2DOF_B, 0.0f, 0.0f, PID_BENCH_2DOF_STEP_MM, PID_BENCH_2DOF_STEPS, PID_BENCH_2DOF_LOAD, &d);
+    for(int k = 0; k < 2; ++k) {
+        printf("2dof %d: overshoot %.2f %%, settle %.2f s, sat %.2f s, dist dev %.3f mm, dist settle %.2f s\n", k,
+            d.overshoot_pct[k], d.settle_s[k], d.sat_s[k], d.dist_dev_mm[k], d.dist_settle_s[k]);
+    }
+    TEST_NEAR(d.dist_dev_mm[1], d.dist_dev_mm[0], 0.05 * fabsf(d.dist_dev_mm[0]), "2dof disturbance deviation");
+    TEST_CHECK(d.overshoot_pct[1] <= d.overshoot_pct[0], "2dof overshoot %.2f %%, 1dof %.2f %%",
+        d.overshoot_pct[1], d.overshoot_pct[0]);
+    TEST_CHECK(d.sat_s[1] <= d.sat_s[0], "2dof saturated %.2f s, 1dof %.2f s", d.sat_s[1], d.sat_s[0]);
+
+    /* 命令只挂起, 由状态机在空闲时运行 */
+    TEST_CHECK(s_pid_bench_request("$PID_BENCH#"), "$PID_BENCH# not recognised");
+    TEST_CHECK(s_pid_bench_request("$PID_BENCH_BANK#"), "$PID_BENCH_BANK# not recognised");
+    TEST_CHECK(s_pid_bench_request("$PID_BENCH_2DOF#"), "$PID_BENCH_2DOF# not recognised");
+    TEST_CHECK(s_pid_bench_request("$PID_BENCH_2DOF:0.5,0,0.02#"), "$PID_BENCH_2DOF:b,c,tf# not recognised");
+    TEST_CHECK(!s_pid_bench_request("$PID_BENCHX#"), "$PID_BENCHX# recognised");
+    s_pid_bench_reject();
+    printf("\n");
+
+    return TEST_RESULT("test_pid_bench");
+}
@@ -0,0 +1,74 @@
+/**
+ * @file    test_relay.c
+ * @brief   继电器驱动: 最短接通 / 断开时间调度, 单次 BSRR 写入切换两个引脚
+ * @note    参数同 a_board.c relay_cfg (最短接通 40 ms, 反向前最短断开 100 ms), 每 10 ms 调用一次 update
+ */
+#include "test.h"
+#include "d_relay.h"
+
+// ! ========================= 变 量 声 明 ========================= ! //
+
+#define PIN_A       0x0001u
+#define PIN_B       0x0002u
+
+static GPIO_TypeDef _port;
+
+static const relay_cfg_t relay_cfg = {
+    .rcc_mask = 0,
+    .rcc_bus = 2,
+    .port = &_port,
+    .pin_a = PIN_A,
+    .pin_b = PIN_B,
+    .min_on_s = 0.04f,
+    .min_off_s = 0.1f,
+};
+
+// ! ========================= 私 有 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   运行到某方向生效, 返回所用时间 (ms), 超过 limit_ms 返回 -1
+ */
+static int run_until(Relay* relay, RelayDir_e dir, int* t_ms, int limit_ms) {
+    for(; *t_ms <= limit_ms; *t_ms += 10) {
+        if(relay->get_dir(relay) == dir) return *t_ms;
+        relay->update(relay, 0.01f);
+    }
+    return -1;
+}
+
+// ! ========================= 接 口 函 数 实 现 ========================= ! //
+
+int main(void) {
+    Relay relay = relay_create();
+    relay.init(&relay, &relay_cfg);
+    TEST_CHECK(_port.BRR == (PIN_A | PIN_B), "init: outputs not cleared before switching to push-pull");
+
+    /* 接通 A: 一次写入置位 A、复位 B */
+    int t = 0;
+    relay.set_dir(&relay, RelayDirA);
+    TEST_CHECK(relay.get_dir(&relay) == RelayDirA, "A not applied at once");
+    TEST_CHECK(_port.BSRR == (PIN_A | ((uint32_t)PIN_B << 16)), "A: BSRR 0x%08x", (unsigned)_port.BSRR);
+
+    /* 10 ms 后请求 B: 满 40 ms 才断开, 再断开 100 ms 后接通 B */
+    relay.update(&relay, 0.01f);
+    t = 10;
+    relay.set_dir(&relay, RelayDirB);
+    TEST_CHECK(relay.get_dir(&relay) == RelayDirA, "B applied before min on time");
+    int t_off = run_until(&relay, RelayDirStop, &t, 1000);
+    int t_b = run_until(&relay, RelayDirB, &t, 1000);
+    TEST_CHECK(t_off == 40, "A released at %d ms, expected 40 ms", t_off);
+    TEST_CHECK(t_b == 140, "B applied at %d ms, expected 140 ms", t_b);
+    TEST_CHECK(_port.BSRR == (PIN_B | ((uint32_t)PIN_A << 16)), "B: BSRR 0x%08x", (unsigned)_port.BSRR);
+
+    /* 紧急停止不受最短接通时间限制 */
+    relay.stop(&relay);
+    TEST_CHECK(relay.get_dir(&relay) == RelayDirStop, "stop deferred");
+    TEST_CHECK(_port.BSRR == ((uint32_t)(PIN_A | PIN_B) << 16), "stop: BSRR 0x%08x", (unsigned)_port.BSRR);
+
+    relay_stats_t st;
+    relay.get_stats(&relay, &st);
+    TEST_CHECK(st.actuations == 2 && st.reversals == 1 && st.deferred == 1,
+        "stats: %u actuations, %u reversals, %u deferred", (unsigned)st.actuations, (unsigned)st.reversals, (unsigned)st.deferred);
+
+    return TEST_RESULT("test_relay");
+}
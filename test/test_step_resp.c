@@ -0,0 +1,85 @@
+/**
+ * @file    test_step_resp.c
+ * @brief   阶跃响应分析: 二阶系统阶跃 (ζ 0.5, ωn 4 rad/s) 的指标与解析值比较, 缓冲区抽取
+ * @note    参数同 a_board.c step_resp_cfg; 100 mm 阶跃, 10 ms 周期记录 7 s (700 点, 抽取到 4 倍).
+ *          解析值: 超调 exp(-πζ/√(1-ζ²)) = 16.3 %, 上升 / 调节时间以 0.1 ms 步长逐点求出
+ */
+#include "test.h"
+#include "s_step_resp.h"
+
+// ! ========================= 变 量 声 明 ========================= ! //
+
+#define DT_S        0.01
+#define TICKS       700
+#define STEP_MM     100.0
+#define ZETA        0.5
+#define WN          4.0
+
+static const step_resp_cfg_t step_resp_cfg = {
+    .band_pct = 2.0f,
+    .band_min_mm = 1.0f,
+    .ss_samples = 50,
+};
+
+// ! ========================= 私 有 函 数 实 现 ========================= ! //
+
+/**
+ * @brief   二阶系统单位阶跃响应
+ */
+static double y(double t) {
+    double wd = WN * sqrt(1.0 - ZETA * ZETA);
+    return 1.0 - exp(-ZETA * WN * t) * (cos(wd * t) + ZETA / sqrt(1.0 - ZETA * ZETA) * sin(wd * t));
+}
+
+// ! ========================= 接 口 函 数 实 现 ========================= ! //
+
+int main(void) {
+    /* 解析值 */
+    double t10 = -1.0, t90 = -1.0, t_out = 0.0, iae = 0.0;
+    for(double t = 0.0; t < TICKS * DT_S; t += 1e-4) {
+        double v = y(t);
+        if(t10 < 0.0 && v >= 0.1) t10 = t;
+        if(t90 < 0.0 && v >= 0.9) t90 = t;
+        if(fabs(1.0 - v) > 0.02) t_out = t;
+        iae += fabs(1.0 - v) * STEP_MM * 1e-4;
+    }
+    double over_pct = 100.0 * exp(-3.14159265 * ZETA / sqrt(1.0 - ZETA * ZETA));
+
+    s_step_resp_init(&step_resp_cfg);
+    s_step_resp_start((float)STEP_MM, 0.0f);
+    for(int k = 1; k <= TICKS; ++k) {
+        s_step_resp_sample((float)STEP_MM, (float)(STEP_MM * y(k * DT_S)), 0.5f, (float)DT_S);
+    }
+    step_resp_result_t r;
+    s_step_resp_finish(&r);
+
+    TEST_NEAR(r.step_mm, STEP_MM, 1e-6, "step");
+    TEST_NEAR(r.overshoot_pct, over_pct, 0.1, "overshoot");
+    TEST_NEAR(r.rise_s, t90 - t10, DT_S, "rise time");
+    TEST_NEAR(r.settle_s, t_out, DT_S, "settling time");
+    TEST_NEAR(r.sse_mm, 0.0, 0.05, "steady-state error");
+    TEST_NEAR(r.iae, iae, 0.02 * iae, "IAE");
+
+    /* 700 点: 写满 256 点两次, 抽取 4 倍; 第 i 点为第 i·decim + 1 个周期 */
+    TEST_CHECK(r.decim == 4 && s_step_resp_decim() == 4, "decimation %u", (unsigned)r.decim);
+    TEST_CHECK(r.samples > STEP_RESP_BUF_LEN / 2 && r.samples <= STEP_RESP_BUF_LEN, "samples %u", (unsigned)r.samples);
+    step_resp_sample_t smp;
+    for(uint16_t i = 0; i < r.samples; i += 37) {
+        TEST_CHECK(s_step_resp_get(i, &smp), "sample %u missing", (unsigned)i);
+        double want = STEP_MM * y((i * r.decim + 1) * DT_S);
+        TEST_CHECK(fabs(smp.pos * 0.1 - want) <= 0.06, "sample %u position %.1f, expected %.2f", (unsigned)i,
+            smp.pos * 0.1, want);
+        TEST_CHECK(smp.target == 1000 && smp.u == 5000, "sample %u target %d u %d", (unsigned)i, smp.target, smp.u);
+    }
+    TEST_CHECK(!s_step_resp_get(r.samples, &smp), "read past the end");
+
+    /* 结果保持到下次结束; 目标改变时重新开始记录 */
+    s_step_resp_sample(50.0f, 100.0f, 0.0f, (float)DT_S);
+    TEST_CHECK(s_step_resp_count() == 1 && s_step_resp_decim() == 1, "restart on target change: %u samples",
+        (unsigned)s_step_resp_count());
+    TEST_CHECK(s_step_resp_result(&r) && r.decim == 4, "previous result lost");
+
+    printf("overshoot %.2f %% (%.2f), rise %.3f s (%.3f), settle %.3f s (%.3f), iae %.2f mm*s\n",
+        r.overshoot_pct, over_pct, r.rise_s, t90 - t10, r.settle_s, t_out, r.iae);
+    return TEST_RESULT("test_step_resp");
+}